@@ -31,6 +31,7 @@ from tools.system_libs import USE_NINJA
 # Minimal subset of targets used by CI systems to build enough to useful
 MINIMAL_TASKS = [
     'libbulkmemory',
+    'libsimdstring',
     'libcompiler_rt',
     'libcompiler_rt-wasm-sjlj',
     'libc',
@@ -217,8 +217,63 @@ def symbolize_address_sourcemap(module, address, force_file):
   sm.lookup(address).print()
 
 
+def get_function_names(module):
+  names = {}
+  section = module.get_custom_section('name')
+  if not section:
+    return names
+  module.seek(section.offset)
+  assert module.read_string() == 'name'
+  end = section.offset + section.size
+  while module.tell() < end:
+    subsection_id = module.read_byte()
+    subsection_size = module.read_uleb()
+    subsection_end = module.tell() + subsection_size
+    if subsection_id == 1:  # function names
+      for _ in range(module.read_uleb()):
+        index = module.read_uleb()
+        names[index] = module.read_string()
+    module.seek(subsection_end)
+  return names
+
+
+def read_symbol_map(filename):
+  names = {}
+  with open(filename) as f:
+    for line in f:
+      index, name = line.rstrip('\n').split(':', 1)
+      names[int(index)] = name
+  return names
+
+
+def symbolize_folded(module, folded_file, symbol_map):
+  """Replace the wasm-function[N] frames in folded stacks, such as the ones
+  written by -sSAMPLING_PROFILER, with function names.  These are the
+  functions that had no name in the name section when the profile was taken;
+  frames that already have a name are left as they are."""
+  if symbol_map:
+    names = read_symbol_map(symbol_map)
+  else:
+    names = get_function_names(module)
+    if not names:
+      raise Error(f'No name section found in {module.filename}, pass a symbol map with -f')
+
+  def replace(match):
+    return names.get(int(match.group(1)), match.group(0))
+
+  with open(folded_file) as f:
+    for line in f:
+      sys.stdout.write(re.sub(r'wasm-function\[(\d+)\]', replace, line))
+
+
 def main(args):
   with webassembly.Module(args.wasm_file) as module:
+    if args.folded:
+      symbolize_folded(module, args.folded, args.file)
+      return
+    if args.address is None:
+      raise Error('an address to look up is required')
+
     base = 16 if args.address.lower().startswith('0x') else 10
     address = int(args.address, base)
 
@@ -249,14 +304,18 @@ def get_args():
                                                  'names', 'symtab'],
                       help='Force debug info source type', default=())
   parser.add_argument('-f', '--file', action='store',
-                      help='Force debug info source file')
+                      help='Force debug info source file (with --folded, a '
+                           'symbol map)')
   parser.add_argument('-t', '--addrtype', choices=['code', 'file'],
                       default='file',
                       help='Address type (code section or file offset)')
   parser.add_argument('-v', '--verbose', action='store_true',
                       help='Print verbose info for debugging this script')
+  parser.add_argument('--folded', action='store',
+                      help='Symbolize the wasm functions in the given file of '
+                           'folded stacks instead of looking up an address')
   parser.add_argument('wasm_file', help='Wasm file')
-  parser.add_argument('address', help='Address to lookup')
+  parser.add_argument('address', nargs='?', help='Address to lookup')
   args = parser.parse_args()
   if args.verbose:
     shared.PRINT_SUBPROCS = 1
@@ -6,50 +6,63 @@
 
 // Support for growable heap + pthreads, where the buffer may change, so JS views
 // must be updated.
+
+// Counts how often the views were found to be stale, see
+// emscripten_get_heap_growth_stats.
+var growableHeapRefreshes = 0;
+
 function GROWABLE_HEAP_I8() {
   if (wasmMemory.buffer != HEAP8.buffer) {
+    growableHeapRefreshes++;
     updateMemoryViews();
   }
   return HEAP8;
 }
 function GROWABLE_HEAP_U8() {
   if (wasmMemory.buffer != HEAP8.buffer) {
+    growableHeapRefreshes++;
     updateMemoryViews();
   }
   return HEAPU8;
 }
 function GROWABLE_HEAP_I16() {
   if (wasmMemory.buffer != HEAP8.buffer) {
+    growableHeapRefreshes++;
     updateMemoryViews();
   }
   return HEAP16;
 }
 function GROWABLE_HEAP_U16() {
   if (wasmMemory.buffer != HEAP8.buffer) {
+    growableHeapRefreshes++;
     updateMemoryViews();
   }
   return HEAPU16;
 }
 function GROWABLE_HEAP_I32() {
   if (wasmMemory.buffer != HEAP8.buffer) {
+    growableHeapRefreshes++;
     updateMemoryViews();
   }
   return HEAP32;
 }
 function GROWABLE_HEAP_U32() {
   if (wasmMemory.buffer != HEAP8.buffer) {
+    growableHeapRefreshes++;
     updateMemoryViews();
   }
   return HEAPU32;
 }
 function GROWABLE_HEAP_F32() {
   if (wasmMemory.buffer != HEAP8.buffer) {
+    growableHeapRefreshes++;
     updateMemoryViews();
   }
   return HEAPF32;
 }
 function GROWABLE_HEAP_F64() {
   if (wasmMemory.buffer != HEAP8.buffer) {
+    growableHeapRefreshes++;
     updateMemoryViews();
   }
   return HEAPF64;
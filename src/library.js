@@ -351,6 +351,15 @@ addToLibrary({
     updateMemoryViews();
   },
 
+  _emscripten_get_heap_view_refreshes: () => {
+#if SHARED_MEMORY && ALLOW_MEMORY_GROWTH && !GROWABLE_ARRAYBUFFERS
+    // Defined in growableHeap.js.
+    return growableHeapRefreshes;
+#else
+    return 0;
+#endif
+  },
+
   _emscripten_system: (command) => {
 #if ENVIRONMENT_MAY_BE_NODE
     if (ENVIRONMENT_IS_NODE) {
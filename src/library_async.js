@@ -29,6 +29,15 @@ addToLibrary({
     'malloc', 'free',
 #endif
   ],
+#if ASYNCIFY_PROFILE
+  // The profile is printed when the runtime exits, and can also be fetched
+  // at any time from Module['asyncifyProfileReport']().
+  $Asyncify__postset: `
+#if EXIT_RUNTIME && !MINIMAL_RUNTIME
+    addOnExit(() => err(Asyncify.getProfileReport()));
+#endif
+    Module['asyncifyProfileReport'] = () => Asyncify.getProfileReport()`,
+#endif
 
   $Asyncify: {
     //
@@ -211,6 +220,9 @@ addToLibrary({
         Asyncify.state = Asyncify.State.Normal;
 #if ASYNCIFY_DEBUG
         dbg('ASYNCIFY: stop unwind');
+#endif
+#if ASYNCIFY_PROFILE
+        Asyncify.profileUnwindEnd(Asyncify.currData);
 #endif
         {{{ runtimeKeepalivePush(); }}}
         // Keep the runtime alive so that a re-wind can be done later.
@@ -231,6 +243,71 @@ addToLibrary({
       });
     },
 
+#if ASYNCIFY_PROFILE
+    // Call stacks that were unwound at runtime, keyed by the names of the wasm
+    // functions on them (innermost first).  For each we track how often it
+    // was unwound and the largest amount of state it saved.
+    profileStacks: {},
+    profileCurrent: null,
+
+    profileUnwindStart(ptr) {
+      var limit = Error.stackTraceLimit;
+      Error.stackTraceLimit = Infinity;
+      var stack = new Error().stack;
+      Error.stackTraceLimit = limit;
+      var funcs = [];
+      for (var line of stack.split('\n')) {
+        // Chrome: '    at foo(int) (wasm://wasm/1234:wasm-function[12]:0x5a)'
+        // Firefox: 'foo(int)@http://server.com/a.wasm:wasm-function[12]:0x5a'
+        var match = /^\s*at (?:(.*) \()?\S*wasm-function\[(\d+)\]/.exec(line) ||
+                    /^(.*)@\S*wasm-function\[(\d+)\]/.exec(line);
+        if (match) funcs.push(match[1] || `wasm-function[${match[2]}]`);
+      }
+      var key = funcs.join(' <- ');
+      var entry = Asyncify.profileStacks[key] ||= { funcs, count: 0, maxBytes: 0 };
+      entry.count++;
+      var start = {{{ makeGetValue('ptr', C_STRUCTS.asyncify_data_s.stack_ptr, '*') }}};
+      Asyncify.profileCurrent = { entry, start };
+    },
+
+    profileUnwindEnd(ptr) {
+      var current = Asyncify.profileCurrent;
+      if (!current) return;
+      Asyncify.profileCurrent = null;
+      var end = {{{ makeGetValue('ptr', C_STRUCTS.asyncify_data_s.stack_ptr, '*') }}};
+      current.entry.maxBytes = Math.max(current.entry.maxBytes, end - current.start);
+    },
+
+    getProfileReport() {
+      var stacks = Object.values(Asyncify.profileStacks);
+      stacks.sort((a, b) => b.count - a.count);
+      var funcs = new Set();
+      var maxBytes = 0, unwinds = 0;
+      var report = '';
+      for (var entry of stacks) {
+        entry.funcs.forEach((f) => funcs.add(f));
+        maxBytes = Math.max(maxBytes, entry.maxBytes);
+        unwinds += entry.count;
+        report += `  ${entry.count} unwinds, ${entry.maxBytes} bytes: ${entry.funcs.join(' <- ')}\n`;
+      }
+      // Leave headroom for deeper or larger frames on paths that were not
+      // exercised while profiling.
+      var stackSize = Math.max(256, Math.ceil(maxBytes * 1.5 / 256) * 256);
+      report = `asyncify profile: ${unwinds} unwinds from ${stacks.length} distinct call stacks, at most ${maxBytes} bytes of saved state\n` + report;
+      if (!stacks.length) {
+        return report + 'asyncify profile: nothing was unwound, so asyncify may not be needed at all';
+      }
+      funcs = Array.from(funcs).sort();
+      if (funcs.some((f) => f.startsWith('wasm-function['))) {
+        report += 'asyncify profile: some functions have no name (make sure the name section is not stripped)\n';
+      }
+      report += 'asyncify profile: these functions can be used as an ASYNCIFY_ONLY response file (e.g. -sASYNCIFY_ONLY=@funcs.txt):\n';
+      report += funcs.join('\n') + '\n';
+      report += `asyncify profile: suggested -sASYNCIFY_STACK_SIZE=${stackSize}`;
+      return report;
+    },
+#endif
+
     allocateData() {
       // An asyncify data structure has three fields:
       //  0  current stack pos
@@ -390,6 +467,9 @@ addToLibrary({
           Asyncify.currData = Asyncify.allocateData();
 #if ASYNCIFY_DEBUG
           dbg(`ASYNCIFY: start unwind ${Asyncify.currData}`);
+#endif
+#if ASYNCIFY_PROFILE
+          Asyncify.profileUnwindStart(Asyncify.currData);
 #endif
           if (typeof Browser != 'undefined' && Browser.mainLoop.func) {
             Browser.mainLoop.pause();
@@ -600,6 +680,9 @@ addToLibrary({
 
 #if ASYNCIFY_DEBUG
       dbg('ASYNCIFY/FIBER: start unwind', asyncifyData);
+#endif
+#if ASYNCIFY_PROFILE
+      Asyncify.profileUnwindStart(asyncifyData);
 #endif
       _asyncify_start_unwind(asyncifyData);
 
@@ -717,7 +717,11 @@ var LibraryBrowser = {
       PATH.basename(_file),
       // TODO: This copy is not needed if the contents are already a Uint8Array,
       //       which they often are (and always are in WasmFS).
+#if MEMFS_PAGE_SIZE
+      FS.readFile(_file), true, true,
+#else
       new Uint8Array(data.object.contents), true, true,
+#endif
       () => {
         {{{ runtimeKeepalivePop() }}}
         if (onload) {{{ makeDynCall('vp', 'onload') }}}(file);
@@ -22,11 +22,17 @@ var LibraryDylink = {
         return !Module['noWasmDecoding'] && name.endsWith('.so')
       },
       'handle': (byteArray, name, onload, onerror) => {
+        // Start compiling straight away so that all the preloaded libraries
+        // compile in parallel.
+        var compiled = WebAssembly.compile(byteArray);
+        // Any failure is reported by the chain below.
+        compiled.catch(() => {});
         // loadWebAssemblyModule can not load modules out-of-order, so rather
         // than just running the promises in parallel, this makes a chain of
         // promises to run in series.
         wasmPlugin['promiseChainEnd'] = wasmPlugin['promiseChainEnd'].then(
-          () => loadWebAssemblyModule(byteArray, {loadAsync: true, nodelete: true}, name, {})).then(
+          () => compiled).then(
+          (module) => loadWebAssemblyModule(module, {loadAsync: true, nodelete: true}, name, {})).then(
             (exports) => {
 #if DYLINK_DEBUG
               dbg(`registering preloadedWasm: ${name}`);
@@ -151,12 +157,21 @@ var LibraryDylink = {
   },
 
   $GOT: {},
+  // The value of every symbol exported by a loaded module, keyed by name.
+  // GOT entries are only created for symbols that some module imports via
+  // GOT.mem or GOT.func (see GOTHandler), and take their initial value from
+  // here.  This saves creating a global, and for functions a table slot, for
+  // every export of every module.
+  $GOTDefs: '=new Map()',
+  // Names of the GOT entries that have no value yet.  This is all that
+  // `reportUndefinedSymbols` has to look at after each module is loaded.
+  $unresolvedGOT: '=new Set()',
   $currentModuleWeakSymbols: '=new Set({{{ JSON.stringify(Array.from(WEAK_IMPORTS)) }}})',
 
   // Create globals to each imported symbol.  These are all initialized to zero
   // and get assigned later in `updateGOT`
   $GOTHandler__internal: true,
-  $GOTHandler__deps: ['$GOT', '$currentModuleWeakSymbols'],
+  $GOTHandler__deps: ['$GOT', '$GOTDefs', '$unresolvedGOT', '$setGOTEntry', '$currentModuleWeakSymbols'],
   $GOTHandler: {
     get(obj, symName) {
       var rtn = GOT[symName];
@@ -165,6 +180,12 @@ var LibraryDylink = {
 #if DYLINK_DEBUG == 2
         dbg("new GOT entry: " + symName);
 #endif
+        var value = GOTDefs.get(symName);
+        if (value !== undefined) {
+          setGOTEntry(symName, value);
+        } else {
+          unresolvedGOT.add(symName);
+        }
       }
       if (!currentModuleWeakSymbols.has(symName)) {
         // Any non-weak reference to a symbol marks it as `required`, which
@@ -202,8 +223,34 @@ var LibraryDylink = {
     ;
   },
 
+  // Assigns a GOT entry from an exported value.
+  $setGOTEntry__internal: true,
+  $setGOTEntry__deps: ['$GOT', '$unresolvedGOT', '$addFunction'],
+  $setGOTEntry: (symName, value) => {
+#if DYLINK_DEBUG == 2
+    dbg(`setGOTEntry: before: ${symName} : ${GOT[symName].value}`);
+#endif
+    if (typeof value == 'function') {
+      GOT[symName].value = {{{ to64('addFunction(value)') }}};
+#if DYLINK_DEBUG == 2
+      dbg(`setGOTEntry: FUNC: ${symName} : ${GOT[symName].value}`);
+#endif
+    } else if (typeof value == {{{ POINTER_JS_TYPE }}}) {
+      GOT[symName].value = value;
+    } else {
+      err(`unhandled export type for '${symName}': ${typeof value}`);
+      return;
+    }
+    unresolvedGOT.delete(symName);
+#if DYLINK_DEBUG == 2
+    dbg(`setGOTEntry:  after: ${symName} : ${GOT[symName].value} (${value})`);
+#endif
+  },
+
+  // Records the exports of a newly loaded module in `GOTDefs`, and updates
+  // any existing GOT entries that they define.
   $updateGOT__internal: true,
-  $updateGOT__deps: ['$GOT', '$isInternalSym', '$addFunction', '$getFunctionAddress'],
+  $updateGOT__deps: ['$GOT', '$GOTDefs', '$isInternalSym', '$setGOTEntry'],
   $updateGOT: (exports, replace) => {
 #if DYLINK_DEBUG
     dbg("updateGOT: adding " + Object.keys(exports).length + " symbols");
@@ -221,30 +268,21 @@ var LibraryDylink = {
       }
 #endif
 
-      GOT[symName] ||= new WebAssembly.Global({'value': '{{{ POINTER_WASM_TYPE }}}', 'mutable': true});
-      if (replace || GOT[symName].value == 0) {
-#if DYLINK_DEBUG == 2
-        dbg(`updateGOT: before: ${symName} : ${GOT[symName].value}`);
-#endif
-        if (typeof value == 'function') {
-          GOT[symName].value = {{{ to64('addFunction(value)') }}};
-#if DYLINK_DEBUG == 2
-          dbg(`updateGOT: FUNC: ${symName} : ${GOT[symName].value}`);
-#endif
-        } else if (typeof value == {{{ POINTER_JS_TYPE }}}) {
-          GOT[symName].value = value;
-        } else {
-          err(`unhandled export type for '${symName}': ${typeof value}`);
+      // The first definition of a symbol wins, unless we are asked to replace
+      // it.
+      if (!replace && GOTDefs.has(symName)) {
+#if DYLINK_DEBUG
+        if (GOTDefs.get(symName) != value) {
+          dbg(`updateGOT: EXISTING SYMBOL: ${symName} : ${GOTDefs.get(symName)} (${value})`);
         }
-#if DYLINK_DEBUG == 2
-        dbg(`updateGOT:  after: ${symName} : ${GOT[symName].value} (${value})`);
 #endif
+        continue;
       }
-#if DYLINK_DEBUG
-      else if (GOT[symName].value != value) {
-        dbg(`updateGOT: EXISTING SYMBOL: ${symName} : ${GOT[symName].value} (${value})`);
+      GOTDefs.set(symName, value);
+      var entry = GOT[symName];
+      if (entry && (replace || entry.value == 0)) {
+        setGOTEntry(symName, value);
       }
-#endif
     }
 #if DYLINK_DEBUG
     dbg("done updateGOT");
@@ -282,12 +320,13 @@ var LibraryDylink = {
   },
 
   $reportUndefinedSymbols__internal: true,
-  $reportUndefinedSymbols__deps: ['$GOT', '$resolveGlobalSymbol'],
+  $reportUndefinedSymbols__deps: ['$GOT', '$unresolvedGOT', '$resolveGlobalSymbol'],
   $reportUndefinedSymbols: () => {
 #if DYLINK_DEBUG
-    dbg('reportUndefinedSymbols');
+    dbg(`reportUndefinedSymbols: ${unresolvedGOT.size} unresolved`);
 #endif
-    for (var [symName, entry] of Object.entries(GOT)) {
+    for (var symName of unresolvedGOT) {
+      var entry = GOT[symName];
       if (entry.value == 0) {
         var value = resolveGlobalSymbol(symName, true).sym;
         if (!value && !entry.required) {
@@ -319,6 +358,7 @@ var LibraryDylink = {
           throw new Error(`bad export type for '${symName}': ${typeof value}`);
         }
       }
+      unresolvedGOT.delete(symName);
     }
 #if DYLINK_DEBUG
     dbg('done reportUndefinedSymbols');
@@ -332,6 +372,9 @@ var LibraryDylink = {
     loadedLibsByName: {},
     // handle  -> dso; Used by dlsym
     loadedLibsByHandle: {},
+    // name -> promise of a compiled WebAssembly.Module; See
+    // prefetchDynamicLibrary
+    pendingModules: {},
     init() {
 #if ASSERTIONS
       // This function needs to run after the initial wasmImports object
@@ -363,7 +406,7 @@ var LibraryDylink = {
   // Allocate memory even if malloc isn't ready yet.  The allocated memory here
   // must be zero initialized since its used for all static data, including bss.
   $getMemory__noleakcheck: true,
-  $getMemory__deps: ['$GOT', '__heap_base', '$zeroMemory', '$alignMemory', 'malloc'],
+  $getMemory__deps: ['$GOT', '$GOTDefs', '__heap_base', '$zeroMemory', '$alignMemory', 'malloc'],
   $getMemory: (size) => {
     // After the runtime is initialized, we must only use sbrk() normally.
 #if DYLINK_DEBUG
@@ -382,7 +425,12 @@ var LibraryDylink = {
     assert(end <= HEAP8.length, 'failure to getMemory - memory growth etc. is not supported there, call malloc/sbrk directly or increase INITIAL_MEMORY');
 #endif
     ___heap_base = end;
-    GOT['__heap_base'].value = {{{ to64('end') }}};
+    // Modules loaded from now on must see the new value, as well as those
+    // that already imported it.
+    GOTDefs.set('__heap_base', {{{ to64('end') }}});
+    if (GOT['__heap_base']) {
+      GOT['__heap_base'].value = {{{ to64('end') }}};
+    }
     return ret;
   },
 
@@ -595,12 +643,15 @@ var LibraryDylink = {
     * @param {number=} handle
     */`,
   $loadWebAssemblyModule__deps: [
-    '$loadDynamicLibrary', '$getMemory',
+    '$loadDynamicLibrary', '$prefetchDynamicLibrary', '$getMemory',
     '$relocateExports', '$resolveGlobalSymbol', '$GOTHandler',
     '$getDylinkMetadata', '$alignMemory', '$zeroMemory',
     '$currentModuleWeakSymbols',
     '$updateTableMap',
     '$wasmTable',
+#if PTHREADS
+    '$registerSharedModule',
+#endif
   ],
   $loadWebAssemblyModule: (binary, flags, libName, localScope, handle) => {
 #if DYLINK_DEBUG
@@ -732,13 +783,13 @@ var LibraryDylink = {
         assert(wasmTable === originalTable);
 #endif
 #if PTHREADS
-        if (!ENVIRONMENT_IS_PTHREAD && libName) {
+        if (libName && sharedModules[libName] !== module) {
 #if DYLINK_DEBUG
           dbg(`registering sharedModules: ${libName}`)
 #endif
-          // cache all loaded modules in `sharedModules`, which gets passed
-          // to new workers when they are created.
-          sharedModules[libName] = module;
+          // Hand the compiled module to all the other threads so that none of
+          // them has to compile it again.
+          registerSharedModule(libName, module);
         }
 #endif
         // add new entries to functionsInTableMap
@@ -860,8 +911,9 @@ var LibraryDylink = {
 
       if (flags.loadAsync) {
         if (binary instanceof WebAssembly.Module) {
-          var instance = new WebAssembly.Instance(binary, info);
-          return Promise.resolve(postInstantiation(binary, instance));
+          return WebAssembly.instantiate(binary, info).then(
+            (instance) => postInstantiation(binary, instance)
+          );
         }
         return WebAssembly.instantiate(binary, info).then(
           (result) => postInstantiation(result.module, result.instance)
@@ -875,6 +927,9 @@ var LibraryDylink = {
 
     // now load needed libraries and the module itself.
     if (flags.loadAsync) {
+      // The libraries are instantiated one at a time, in order, but they can
+      // all be compiled at once.
+      metadata.neededDynlibs.forEach((needed) => prefetchDynamicLibrary(needed));
       return metadata.neededDynlibs
         .reduce((chain, dynNeeded) => chain.then(() =>
           loadDynamicLibrary(dynNeeded, flags, localScope)
@@ -901,6 +956,59 @@ var LibraryDylink = {
   },
 #endif
 
+#if PTHREADS
+  // Records a compiled side module in `sharedModules`, which gets passed to
+  // new workers when they are created, and sends it to all the existing
+  // threads.  A thread that catches up with a dlopen (see
+  // `_emscripten_dlsync_self`) after the module has reached it instantiates
+  // it directly instead of compiling the library again.
+  $registerSharedModule: (libName, module, sourceWorker) => {
+    sharedModules[libName] = module;
+    var msg = {'cmd': 'sharedModule', 'name': libName, 'module': module};
+    if (ENVIRONMENT_IS_PTHREAD) {
+      // The main thread passes it on to the other workers.
+      postMessage(msg);
+      return;
+    }
+    for (var worker of PThread.runningWorkers.concat(PThread.unusedWorkers)) {
+      if (worker !== sourceWorker) {
+        worker.postMessage(msg);
+      }
+    }
+  },
+#endif
+
+  // Starts fetching and compiling a side module that is about to be loaded.
+  // Libraries have to be instantiated one at a time, in dependency order, but
+  // when several of them are needed at once they can be compiled in parallel.
+  // loadDynamicLibrary picks up the result.
+  $prefetchDynamicLibrary__deps: ['$LDSO', '$asyncLoad',
+#if FILESYSTEM
+                                  '$preloadedWasm',
+#endif
+  ],
+  $prefetchDynamicLibrary: (libName) => {
+    if (LDSO.loadedLibsByName[libName] || LDSO.pendingModules[libName]) {
+      return;
+    }
+#if FILESYSTEM
+    if (preloadedWasm[libName]) return;
+#endif
+#if PTHREADS
+    if (sharedModules[libName]) return;
+#endif
+#if DYLINK_DEBUG
+    dbg(`prefetchDynamicLibrary: ${libName}`);
+#endif
+    var promise = new Promise((resolve, reject) => {
+      asyncLoad(locateFile(libName), resolve, reject);
+    }).then((binary) => WebAssembly.compile(binary));
+    // Failures are reported when the library is loaded.  Don't also report
+    // them here if loading stops early and never gets that far.
+    promise.catch(() => {});
+    LDSO.pendingModules[libName] = promise;
+  },
+
   $newDSO: (name, handle, syms) => {
     var dso = {
       refcount: Infinity,
@@ -1006,6 +1114,14 @@ var LibraryDylink = {
         }
       }
 
+      var pending = LDSO.pendingModules[libName];
+      if (pending) {
+        delete LDSO.pendingModules[libName];
+        if (flags.loadAsync) {
+          return pending;
+        }
+      }
+
       var libFile = locateFile(libName);
       if (flags.loadAsync) {
         return new Promise(function(resolve, reject) {
@@ -1069,7 +1185,7 @@ var LibraryDylink = {
   },
 
   $loadDylibs__internal: true,
-  $loadDylibs__deps: ['$loadDynamicLibrary', '$reportUndefinedSymbols'],
+  $loadDylibs__deps: ['$loadDynamicLibrary', '$prefetchDynamicLibrary', '$reportUndefinedSymbols'],
   $loadDylibs: () => {
     if (!dynamicLibraries.length) {
 #if DYLINK_DEBUG
@@ -1083,8 +1199,10 @@ var LibraryDylink = {
     dbg(`loadDylibs: ${dynamicLibraries}`);
 #endif
 
-    // Load binaries asynchronously
+    // Load binaries asynchronously.  They are compiled in parallel but
+    // instantiated in order.
     addRunDependency('loadDylibs');
+    dynamicLibraries.forEach((lib) => prefetchDynamicLibrary(lib));
     dynamicLibraries
       .reduce((chain, lib) => chain.then(() =>
         loadDynamicLibrary(lib, {loadAsync: true, global: true, nodelete: true, allowUndefined: true})
@@ -8,6 +8,8 @@ var LibraryHTML5 = {
   $JSEvents__deps: [
 #if PTHREADS
     '_emscripten_run_callback_on_thread',
+    '_emscripten_html5_event_ring_push',
+    'malloc',
 #endif
   ],
   $JSEvents: {
@@ -224,6 +226,17 @@ var LibraryHTML5 = {
           return targetThread;
       }
     },
+
+    // Delivers the event struct at `eventData` to `callbackfunc` on
+    // `targetThread`.  If that thread has enabled an event ring (see
+    // emscripten_html5_enable_event_ring) the event is copied into the ring,
+    // otherwise a copy is made on the heap and proxied to the thread.
+    queueEventOnThread(targetThread, callbackfunc, eventTypeId, eventData, eventSize, userData) {
+      if (__emscripten_html5_event_ring_push(targetThread, callbackfunc, eventTypeId, eventData, eventSize, userData)) return;
+      var data = _malloc(eventSize);
+      HEAPU8.copyWithin(data, eventData, eventData + eventSize);
+      __emscripten_run_callback_on_thread(targetThread, callbackfunc, eventTypeId, data, userData);
+    },
 #endif
 
     getNodeNameForTarget(target) {
@@ -260,11 +273,7 @@ var LibraryHTML5 = {
       assert(e);
 #endif
 
-#if PTHREADS
-      var keyEventData = targetThread ? _malloc({{{ C_STRUCTS.EmscriptenKeyboardEvent.__size__ }}}) : JSEvents.keyEvent; // This allocated block is passed as satellite data to the proxied function call, so the call frees up the data block when done.
-#else
       var keyEventData = JSEvents.keyEvent;
-#endif
       {{{ makeSetValue('keyEventData', C_STRUCTS.EmscriptenKeyboardEvent.timestamp, 'e.timeStamp', 'double') }}};
 
       var idx = {{{ getHeapOffset('keyEventData', 'i32') }}};
@@ -284,7 +293,7 @@ var LibraryHTML5 = {
       stringToUTF8(e.locale || '', keyEventData + {{{ C_STRUCTS.EmscriptenKeyboardEvent.locale }}}, {{{ cDefs.EM_HTML5_SHORT_STRING_LEN_BYTES }}});
 
 #if PTHREADS
-      if (targetThread) __emscripten_run_callback_on_thread(targetThread, callbackfunc, eventTypeId, keyEventData, userData);
+      if (targetThread) JSEvents.queueEventOnThread(targetThread, callbackfunc, eventTypeId, keyEventData, {{{ C_STRUCTS.EmscriptenKeyboardEvent.__size__ }}}, userData);
       else
 #endif
       if ({{{ makeDynCall('iipp', 'callbackfunc') }}}(eventTypeId, keyEventData, userData)) e.preventDefault();
@@ -515,11 +524,8 @@ var LibraryHTML5 = {
       fillMouseEventData(JSEvents.mouseEvent, e, target);
 
 #if PTHREADS
-      if (targetThread) {
-        var mouseEventData = _malloc({{{ C_STRUCTS.EmscriptenMouseEvent.__size__ }}}); // This allocated block is passed as satellite data to the proxied function call, so the call frees up the data block when done.
-        fillMouseEventData(mouseEventData, e, target);
-        __emscripten_run_callback_on_thread(targetThread, callbackfunc, eventTypeId, mouseEventData, userData);
-      } else
+      if (targetThread) JSEvents.queueEventOnThread(targetThread, callbackfunc, eventTypeId, JSEvents.mouseEvent, {{{ C_STRUCTS.EmscriptenMouseEvent.__size__ }}}, userData);
+      else
 #endif
       if ({{{ makeDynCall('iipp', 'callbackfunc') }}}(eventTypeId, JSEvents.mouseEvent, userData)) e.preventDefault();
     };
@@ -602,18 +608,14 @@ var LibraryHTML5 = {
 
     // The DOM Level 3 events spec event 'wheel'
     var wheelHandlerFunc = (e = event) => {
-#if PTHREADS
-      var wheelEvent = targetThread ? _malloc({{{ C_STRUCTS.EmscriptenWheelEvent.__size__ }}}) : JSEvents.wheelEvent; // This allocated block is passed as satellite data to the proxied function call, so the call frees up the data block when done.
-#else
       var wheelEvent = JSEvents.wheelEvent;
-#endif
       fillMouseEventData(wheelEvent, e, target);
       {{{ makeSetValue('wheelEvent', C_STRUCTS.EmscriptenWheelEvent.deltaX, 'e["deltaX"]', 'double') }}};
       {{{ makeSetValue('wheelEvent', C_STRUCTS.EmscriptenWheelEvent.deltaY, 'e["deltaY"]', 'double') }}};
       {{{ makeSetValue('wheelEvent', C_STRUCTS.EmscriptenWheelEvent.deltaZ, 'e["deltaZ"]', 'double') }}};
       {{{ makeSetValue('wheelEvent', C_STRUCTS.EmscriptenWheelEvent.deltaMode, 'e["deltaMode"]', 'i32') }}};
 #if PTHREADS
-      if (targetThread) __emscripten_run_callback_on_thread(targetThread, callbackfunc, eventTypeId, wheelEvent, userData);
+      if (targetThread) JSEvents.queueEventOnThread(targetThread, callbackfunc, eventTypeId, wheelEvent, {{{ C_STRUCTS.EmscriptenWheelEvent.__size__ }}}, userData);
       else
 #endif
       if ({{{ makeDynCall('iipp', 'callbackfunc') }}}(eventTypeId, wheelEvent, userData)) e.preventDefault();
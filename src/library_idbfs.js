@@ -23,6 +23,13 @@ addToLibrary({
     },
     DB_VERSION: 21,
     DB_STORE_NAME: 'FILE_DATA',
+    // Files larger than this are stored as separate chunk records by
+    // incremental mounts, so that a small change does not rewrite the whole
+    // file.  Can be overridden with the `chunkSize` mount option.
+    DEFAULT_CHUNK_SIZE: 1024 * 1024,
+    // Set while applying remote entries to the local filesystem, so that
+    // these changes are not tracked as local modifications.
+    populating: false,
 
     // Queues a new VFS -> IDBFS synchronization operation
     queuePersist: (mount) => {
@@ -54,10 +61,24 @@ addToLibrary({
     mount: (mount) => {
       // reuse core MEMFS functionality
       var mnt = MEMFS.mount(mount);
-      // If the automatic IDBFS persistence option has been selected, then automatically persist
-      // all modifications to the filesystem as they occur.
-      if (mount?.opts?.autoPersist) {
-        mnt.idbPersistState = 0; // IndexedDB sync starts in idle state
+      var autoPersist = mount?.opts?.autoPersist;
+      // With the incremental option, changes are tracked as they happen so
+      // that syncfs() only has to write the modified entries (and, for large
+      // files, only the modified chunks) rather than rescanning everything.
+      if (mount?.opts?.incremental) {
+        mount.idbChunkSize = mount.opts.chunkSize || IDBFS.DEFAULT_CHUNK_SIZE;
+        mount.idbDirty = new Map();
+        mount.idbRemoved = new Set();
+        // Dirty tracking only becomes authoritative after the first full sync.
+        mount.idbSynced = false;
+      }
+      if (autoPersist || mount.idbDirty) {
+        // If the automatic IDBFS persistence option has been selected, then
+        // automatically persist all modifications to the filesystem as they
+        // occur.
+        if (autoPersist) {
+          mnt.idbPersistState = 0; // IndexedDB sync starts in idle state
+        }
         var memfs_node_ops = mnt.node_ops;
         mnt.node_ops = Object.assign({}, mnt.node_ops); // Clone node_ops to inject write tracking
         mnt.node_ops.mknod = (parent, name, mode, dev) => {
@@ -75,32 +96,157 @@ addToLibrary({
           node.stream_ops.write = (stream, buffer, offset, length, position, canOwn) => {
             // This file has been modified, we must persist IndexedDB when this file closes
             stream.node.isModified = true;
+            IDBFS.markDirty(stream.node, position, position + length);
             return node.memfs_stream_ops.write(stream, buffer, offset, length, position, canOwn);
           };
 
+          // MEMFS writes back mmap'd files and extends files with
+          // posix_fallocate without going through the write above.
+          if (node.memfs_stream_ops.msync) {
+            node.stream_ops.msync = (stream, buffer, offset, length, mmapFlags) => {
+              stream.node.isModified = true;
+              IDBFS.markDirty(stream.node, offset, offset + length);
+              return node.memfs_stream_ops.msync(stream, buffer, offset, length, mmapFlags);
+            };
+          }
+          if (node.memfs_stream_ops.allocate) {
+            node.stream_ops.allocate = (stream, offset, length) => {
+              var n = stream.node;
+              n.isModified = true;
+              IDBFS.markDirty(n, Math.min(n.usedBytes, offset + length), offset + length);
+              return node.memfs_stream_ops.allocate(stream, offset, length);
+            };
+          }
+
           // Persist IndexedDB on file close
           node.stream_ops.close = (stream) => {
             var n = stream.node;
             if (n.isModified) {
-              IDBFS.queuePersist(n.idbfs_mount);
+              if (autoPersist) IDBFS.queuePersist(n.idbfs_mount);
               n.isModified = false;
             }
             if (n.memfs_stream_ops.close) return n.memfs_stream_ops.close(stream);
           };
 
+          IDBFS.markDirty(node);
+          IDBFS.markDirty(parent, 0, 0);
           return node;
         };
+        if (mount.idbDirty) {
+          mnt.node_ops.setattr = (node, attr) => {
+            if (attr.size !== undefined) {
+              // Only the chunks from the old or new end of file onwards change.
+              IDBFS.markDirty(node, Math.min(attr.size, node.usedBytes), Math.max(attr.size, node.usedBytes));
+            } else {
+              IDBFS.markDirty(node, 0, 0);
+            }
+            return memfs_node_ops.setattr(node, attr);
+          };
+        }
         // Also kick off persisting the filesystem on other operations that modify the filesystem.
-        mnt.node_ops.mkdir   = (...args) => (IDBFS.queuePersist(mnt.mount), memfs_node_ops.mkdir(...args));
-        mnt.node_ops.rmdir   = (...args) => (IDBFS.queuePersist(mnt.mount), memfs_node_ops.rmdir(...args));
-        mnt.node_ops.symlink = (...args) => (IDBFS.queuePersist(mnt.mount), memfs_node_ops.symlink(...args));
-        mnt.node_ops.unlink  = (...args) => (IDBFS.queuePersist(mnt.mount), memfs_node_ops.unlink(...args));
-        mnt.node_ops.rename  = (...args) => (IDBFS.queuePersist(mnt.mount), memfs_node_ops.rename(...args));
+        var track = (f) => (...args) => {
+          if (autoPersist) IDBFS.queuePersist(mnt.mount);
+          return f(...args);
+        };
+        mnt.node_ops.mkdir   = track(memfs_node_ops.mkdir);
+        mnt.node_ops.symlink = track(memfs_node_ops.symlink);
+        mnt.node_ops.rmdir   = track((parent, name) => {
+          var node = parent.contents[name];
+          memfs_node_ops.rmdir(parent, name);
+          IDBFS.markRemoved(node);
+        });
+        mnt.node_ops.unlink  = track((parent, name) => {
+          var node = parent.contents[name];
+          memfs_node_ops.unlink(parent, name);
+          IDBFS.markRemoved(node);
+        });
+        mnt.node_ops.rename  = track((old_node, new_dir, new_name) => {
+          var oldPath = FS.getPath(old_node);
+          var replaced = new_dir.contents[new_name];
+          memfs_node_ops.rename(old_node, new_dir, new_name);
+          IDBFS.markRenamed(old_node, new_dir, oldPath, replaced);
+        });
       }
       return mnt;
     },
 
+    // Records that the byte range [start, end) of the given node changed.
+    // When no range is given the whole node is considered new, and an empty
+    // range marks only its metadata (mode, timestamp) as changed.
+    markDirty: (node, start, end) => {
+      var mount = node.mount;
+      if (!mount.idbDirty || IDBFS.populating || node.idbDeleted) return;
+      // The mount point itself is not stored.
+      if (node === mount.root) return;
+      var chunks = mount.idbDirty.get(node);
+      if (chunks === null) return; // Already fully dirty.
+      if (start === undefined) {
+        mount.idbDirty.set(node, null);
+        return;
+      }
+      if (!chunks) {
+        chunks = new Set();
+        mount.idbDirty.set(node, chunks);
+      }
+      var chunkSize = mount.idbChunkSize;
+      for (var i = Math.floor(start / chunkSize); i * chunkSize < end; i++) {
+        chunks.add(i);
+      }
+    },
+
+    // Records that the node (which must not have any children) has been
+    // removed from the filesystem.
+    markRemoved: (node) => {
+      var mount = node.mount;
+      if (!mount.idbDirty || IDBFS.populating) return;
+      mount.idbRemoved.add(FS.getPath(node));
+      mount.idbDirty.delete(node);
+      // The node may still be written to through an open file descriptor,
+      // but must not be persisted again.
+      node.idbDeleted = true;
+      IDBFS.markDirty(node.parent, 0, 0);
+    },
+
+    // A rename moves the whole subtree, so every entry under the old path is
+    // removed and every entry under the new path is rewritten.  This is called
+    // before FS.rename has updated node.parent.
+    markRenamed: (node, new_dir, oldPath, replaced) => {
+      var mount = node.mount;
+      if (!mount.idbDirty || IDBFS.populating) return;
+      if (replaced && replaced !== node) IDBFS.markRemoved(replaced);
+      IDBFS.markDirty(node.parent, 0, 0);
+      IDBFS.markDirty(new_dir, 0, 0);
+      var newPath = PATH.join2(FS.getPath(new_dir), node.name);
+      var visit = (node, rel) => {
+        mount.idbRemoved.add(oldPath + rel);
+        mount.idbRemoved.add(newPath + rel);
+        mount.idbDirty.set(node, null);
+        // Nothing is stored under the new path yet.
+        node.idbChunks = 0;
+        if (FS.isDir(node.mode)) {
+          for (var name of Object.keys(node.contents)) {
+            visit(node.contents[name], `${rel}/${name}`);
+          }
+        }
+      };
+      visit(node, '');
+    },
+
     syncfs: (mount, populate, callback) => {
+      if (mount.idbDirty) {
+        if (!populate && mount.idbSynced) {
+          return IDBFS.syncDirty(mount, callback);
+        }
+        // A full reconcile brings both sides in sync, after which only the
+        // changes made from now on need to be persisted.
+        mount.idbDirty = new Map();
+        mount.idbRemoved = new Set();
+        var onFullSync = callback;
+        callback = (err) => {
+          mount.idbSynced = !err;
+          onFullSync(err);
+        };
+      }
       IDBFS.getLocalSet(mount, (err, local) => {
         if (err) return callback(err);
 
@@ -191,7 +337,7 @@ addToLibrary({
         entries[path] = { 'timestamp': stat.mtime };
       }
 
-      return callback(null, { type: 'local', entries: entries });
+      return callback(null, { type: 'local', mount, entries: entries });
     },
     getRemoteSet: (mount, callback) => {
       var entries = {};
@@ -248,11 +394,17 @@ addToLibrary({
       }
     },
     storeLocalEntry: (path, entry, callback) => {
+      IDBFS.populating = true;
       try {
         if (FS.isDir(entry['mode'])) {
           FS.mkdirTree(path, entry['mode']);
         } else if (FS.isFile(entry['mode'])) {
           FS.writeFile(path, entry['contents'], { canOwn: true });
+          // Remember how the file is laid out remotely so that the next
+          // incremental sync knows which chunk records already exist.
+          var node = FS.lookupPath(path).node;
+          node.idbChunks = entry['chunks'] || 0;
+          node.idbChunkSize = entry['chunkSize'];
         } else {
           return callback(new Error('node type not supported'));
         }
@@ -261,11 +413,14 @@ addToLibrary({
         FS.utime(path, entry['timestamp'], entry['timestamp']);
       } catch (e) {
         return callback(e);
+      } finally {
+        IDBFS.populating = false;
       }
 
       callback(null);
     },
     removeLocalEntry: (path, callback) => {
+      IDBFS.populating = true;
       try {
         var stat = FS.stat(path);
 
@@ -276,13 +431,48 @@ addToLibrary({
         }
       } catch (e) {
         return callback(e);
+      } finally {
+        IDBFS.populating = false;
       }
 
       callback(null);
     },
     loadRemoteEntry: (store, path, callback) => {
       var req = store.get(path);
-      req.onsuccess = (event) => callback(null, event.target.result);
+      req.onsuccess = (event) => {
+        var entry = event.target.result;
+        var numChunks = entry?.['chunks'];
+        if (!numChunks) return callback(null, entry);
+        // Large files written by incremental mounts are split into separate
+        // chunk records which we need to reassemble.
+        var contents = new Uint8Array(entry['size']);
+        var pending = numChunks;
+        var failed = false;
+        for (let i = 0; i < numChunks; i++) {
+          var chunkReq = store.get(IDBFS.chunkKey(path, i));
+          chunkReq.onsuccess = (event) => {
+            if (failed) return;
+            var chunk = event.target.result;
+            if (!chunk) {
+              // The chunk record was never written (e.g. an interrupted sync)
+              // or has been evicted.
+              failed = true;
+              return callback(new Error(`IDBFS: missing chunk ${i} of ${path}`));
+            }
+            contents.set(chunk, i * entry['chunkSize']);
+            if (!--pending) {
+              entry['contents'] = contents;
+              callback(null, entry);
+            }
+          };
+          chunkReq.onerror = (e) => {
+            e.preventDefault();
+            if (failed) return;
+            failed = true;
+            callback(e.target.error);
+          };
+        }
+      };
       req.onerror = (e) => {
         callback(e.target.error);
         e.preventDefault();
@@ -290,6 +480,9 @@ addToLibrary({
     },
     storeRemoteEntry: (store, path, entry, callback) => {
       try {
+        // The file may have been stored as chunks by an incremental mount;
+        // those records are stale now that the whole file is written.
+        store.delete(IDBFS.chunkRange(path));
         var req = store.put(entry, path);
       } catch (e) {
         callback(e);
@@ -302,6 +495,8 @@ addToLibrary({
       };
     },
     removeRemoteEntry: (store, path, callback) => {
+      // Also drop any chunk records of the file.
+      store.delete(IDBFS.chunkRange(path));
       var req = store.delete(path);
       req.onsuccess = (event) => callback();
       req.onerror = (e) => {
@@ -309,6 +504,119 @@ addToLibrary({
         e.preventDefault();
       };
     },
+    // Chunk records are keyed by the file path followed by a NUL character
+    // (which cannot appear in a path) and the chunk index.  They have no
+    // timestamp so they never show up in getRemoteSet.
+    chunkKey: (path, i) => `${path}\0${i}`,
+    chunkRange: (path) => IDBKeyRange.bound(path + '\0', path + '\x01', false, true),
+
+    // Reads `length` bytes of file data at `position` without materializing
+    // the whole file.
+    readLocalRange: (node, position, length) => {
+      var buf = new Uint8Array(length);
+      if (length) MEMFS.stream_ops.read({ node }, buf, 0, length, position);
+      return buf;
+    },
+
+    // Queues the IndexedDB requests that bring the remote copy of a single
+    // node up to date.  `chunks` is the set of modified chunk indices, or null
+    // if the whole node needs to be written.
+    storeDirtyNode: (store, mount, path, node, chunks) => {
+      var stat = FS.stat(path);
+      if (FS.isDir(stat.mode)) {
+        store.put({ 'timestamp': stat.mtime, 'mode': stat.mode }, path);
+        return;
+      }
+      if (!FS.isFile(stat.mode)) {
+        throw new Error('node type not supported');
+      }
+      var size = stat.size;
+      var chunkSize = mount.idbChunkSize;
+      var numChunks = size > chunkSize ? Math.ceil(size / chunkSize) : 0;
+      var prevChunks = node.idbChunks || 0;
+      if (node.idbChunkSize != chunkSize) {
+        // The existing chunk records have a different layout.
+        chunks = null;
+      }
+      if (!numChunks) {
+        store.put({ 'timestamp': stat.mtime, 'mode': stat.mode, 'contents': IDBFS.readLocalRange(node, 0, size) }, path);
+      } else {
+        store.put({ 'timestamp': stat.mtime, 'mode': stat.mode, 'size': size, 'chunkSize': chunkSize, 'chunks': numChunks }, path);
+        for (var i = 0; i < numChunks; i++) {
+          if (!chunks || chunks.has(i) || i >= prevChunks) {
+            var start = i * chunkSize;
+            store.put(IDBFS.readLocalRange(node, start, Math.min(chunkSize, size - start)), IDBFS.chunkKey(path, i));
+          }
+        }
+      }
+      for (var i = numChunks; i < prevChunks; i++) {
+        store.delete(IDBFS.chunkKey(path, i));
+      }
+      node.idbChunks = numChunks;
+      node.idbChunkSize = chunkSize;
+    },
+
+    // Persists the changes recorded by markDirty/markRemoved/markRenamed since
+    // the last sync, in a single readwrite transaction.
+    syncDirty: (mount, callback) => {
+      var dirty = mount.idbDirty;
+      var removed = mount.idbRemoved;
+      if (!dirty.size && !removed.size) {
+        return callback(null);
+      }
+      // Changes made while this transaction is in flight go into the next
+      // sync.
+      mount.idbDirty = new Map();
+      mount.idbRemoved = new Set();
+
+      IDBFS.getDB(mount.mountpoint, (err, db) => {
+        var errored = false;
+        function done(err) {
+          if (err && !errored) {
+            errored = true;
+            // We no longer know what is stored remotely, so the next sync has
+            // to be a full one.
+            mount.idbSynced = false;
+            callback(err);
+          }
+        }
+        if (err) return done(err);
+
+        var transaction = db.transaction([IDBFS.DB_STORE_NAME], 'readwrite');
+        var store = transaction.objectStore(IDBFS.DB_STORE_NAME);
+        transaction.onerror = transaction.onabort = (e) => {
+          done(e.target.error);
+          e.preventDefault();
+        };
+        transaction.oncomplete = (e) => {
+          if (!errored) {
+            callback(null);
+          }
+        };
+
+        try {
+          // Requests within a transaction are applied in order, so removals
+          // (children first) happen before the new entries are written
+          // (parents first).
+          for (var path of Array.from(removed).sort().reverse()) {
+            store.delete(IDBFS.chunkRange(path));
+            store.delete(path);
+          }
+          var entries = [];
+          for (var [node, chunks] of dirty) {
+            entries.push([FS.getPath(node), node, chunks]);
+          }
+          entries.sort((a, b) => a[0] < b[0] ? -1 : (a[0] > b[0] ? 1 : 0));
+          for (var [path, node, chunks] of entries) {
+            IDBFS.storeDirtyNode(store, mount, path, node, chunks);
+          }
+        } catch (e) {
+          done(e);
+          transaction.abort();
+        }
+      });
+    },
+
     reconcile: (src, dst, callback) => {
       var total = 0;
 
@@ -366,6 +674,15 @@ addToLibrary({
             if (err) return done(err);
             IDBFS.storeLocalEntry(path, entry, done);
           });
+        } else if (src.mount.idbDirty) {
+          try {
+            // We don't know which chunk records exist remotely, so clear them
+            // all before storing.
+            store.delete(IDBFS.chunkRange(path));
+            IDBFS.storeDirtyNode(store, src.mount, path, FS.lookupPath(path).node, null);
+          } catch (e) {
+            done(e);
+          }
         } else {
           IDBFS.loadLocalEntry(path, (err, entry) => {
             if (err) return done(err);
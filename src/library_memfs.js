@@ -76,6 +76,12 @@ addToLibrary({
         // for performance, and used by default. However, typed arrays are not resizable like normal JS arrays are, so there is a small disk size
         // penalty involved for appending file writes that continuously grow a file similar to std::vector capacity vs used -scheme.
         node.contents = null; 
+#if MEMFS_PAGE_SIZE
+        // With MEMFS_PAGE_SIZE the file data lives in `pages` instead, and
+        // `contents` is only a cache of the contiguous data (see
+        // getFileDataAsTypedArray).
+        node.pages = [];
+#endif
       } else if (FS.isLink(node.mode)) {
         node.node_ops = MEMFS.ops_table.link.node;
         node.stream_ops = MEMFS.ops_table.link.stream;
@@ -92,6 +98,78 @@ addToLibrary({
       return node;
     },
 
+#if MEMFS_PAGE_SIZE
+    // Paged file storage.  Each file node holds a list of pages, each of which
+    // is either null (a hole, reads as zeros) or a Uint8Array of at most
+    // MEMFS_PAGE_SIZE bytes.  Growing a file only ever allocates or resizes the
+    // last page, so appending is linear in the number of bytes written and
+    // never needs to copy the existing file data.
+
+    // Given a file node, returns its file data converted to a typed array.
+    // In paged mode this materializes the pages into a single contiguous array,
+    // which is cached in node.contents until the next modification.
+    getFileDataAsTypedArray(node) {
+      if (!node.usedBytes) return new Uint8Array(0);
+      if (!node.contents) {
+        var contents = new Uint8Array(node.usedBytes);
+        MEMFS.readPages(node, contents, 0, node.usedBytes, 0);
+        node.contents = contents;
+      }
+      return node.contents;
+    },
+
+    // Copies `length` bytes of file data starting at `position` into
+    // `buffer[offset]`.  The caller is responsible for bounds checking against
+    // node.usedBytes.
+    readPages(node, buffer, offset, length, position) {
+      while (length > 0) {
+        var pageIndex = Math.floor(position / {{{ MEMFS_PAGE_SIZE }}});
+        var pageOffset = position % {{{ MEMFS_PAGE_SIZE }}};
+        var chunk = Math.min(length, {{{ MEMFS_PAGE_SIZE }}} - pageOffset);
+        var page = node.pages[pageIndex];
+        var avail = page ? Math.max(0, Math.min(chunk, page.length - pageOffset)) : 0;
+        if (avail) buffer.set(page.subarray(pageOffset, pageOffset + avail), offset);
+        // Anything beyond the allocated part of the page is a hole.
+        if (avail < chunk) buffer.fill(0, offset + avail, offset + chunk);
+        offset += chunk;
+        position += chunk;
+        length -= chunk;
+      }
+    },
+
+    // Returns the page at pageIndex, making sure that it can hold at least
+    // `size` bytes.  Pages grow geometrically up to MEMFS_PAGE_SIZE so that
+    // small files stay small.
+    getWritablePage(node, pageIndex, size) {
+      var page = node.pages[pageIndex];
+      var capacity = page ? page.length : 0;
+      if (capacity >= size) return page;
+      var newCapacity = Math.min({{{ MEMFS_PAGE_SIZE }}}, Math.max(size, capacity * 2, 256));
+      var newPage = new Uint8Array(newCapacity);
+      if (page) newPage.set(page);
+      return node.pages[pageIndex] = newPage;
+    },
+
+    // No storage needs to be reserved up front in paged mode, pages are
+    // allocated as they are written to.
+    expandFileStorage(node, newCapacity) {},
+
+    // Performs an exact resize of the file.  Pages beyond the new size are
+    // dropped and the tail of the last page is cleared so that a subsequent
+    // extension reads back as zeros.
+    resizeFileStorage(node, newSize) {
+      if (node.usedBytes == newSize) return;
+      node.contents = null;
+      var numPages = Math.ceil(newSize / {{{ MEMFS_PAGE_SIZE }}});
+      node.pages.length = Math.min(node.pages.length, numPages);
+      var lastPage = node.pages[numPages - 1];
+      var tail = newSize - (numPages - 1) * {{{ MEMFS_PAGE_SIZE }}};
+      if (lastPage && newSize < node.usedBytes && lastPage.length > tail) {
+        lastPage.fill(0, tail);
+      }
+      node.usedBytes = newSize;
+    },
+#else
     // Given a file node, returns its file data converted to a typed array.
     getFileDataAsTypedArray(node) {
       if (!node.contents) return new Uint8Array(0);
@@ -132,6 +210,8 @@ addToLibrary({
       }
     },
 
+#endif // MEMFS_PAGE_SIZE
+
     node_ops: {
       getattr(node) {
         var attr = {};
@@ -238,12 +318,17 @@ addToLibrary({
 #if ASSERTIONS
         assert(size >= 0);
 #endif
+#if MEMFS_PAGE_SIZE
+        MEMFS.readPages(stream.node, buffer, offset, size, position);
+        return size;
+#else
         if (size > 8 && contents.subarray) { // non-trivial, and typed array
           buffer.set(contents.subarray(position, position + size), offset);
         } else {
           for (var i = 0; i < size; i++) buffer[offset + i] = contents[position + i];
         }
         return size;
+#endif
       },
 
       // Writes the byte range (buffer[offset], buffer[offset+length]) to offset 'position' into the file pointed by 'stream'
@@ -271,6 +356,38 @@ addToLibrary({
         var node = stream.node;
         node.timestamp = Date.now();
 
+#if MEMFS_PAGE_SIZE
+        // Any cached contiguous copy is now stale.
+        node.contents = null;
+        if (canOwn && position === 0 && node.usedBytes <= length) {
+          // Adopt the caller's buffer by slicing it into page views, without
+          // copying any data.
+          node.pages = [];
+          for (var i = 0; i < length; i += {{{ MEMFS_PAGE_SIZE }}}) {
+            node.pages.push(buffer.subarray(offset + i, offset + Math.min(length, i + {{{ MEMFS_PAGE_SIZE }}})));
+          }
+          node.usedBytes = length;
+          return length;
+        }
+        var written = 0;
+        while (written < length) {
+          var pos = position + written;
+          var pageIndex = Math.floor(pos / {{{ MEMFS_PAGE_SIZE }}});
+          var pageOffset = pos % {{{ MEMFS_PAGE_SIZE }}};
+          var chunk = Math.min(length - written, {{{ MEMFS_PAGE_SIZE }}} - pageOffset);
+          var page = MEMFS.getWritablePage(node, pageIndex, pageOffset + chunk);
+          if (buffer.subarray) {
+            page.set(buffer.subarray(offset + written, offset + written + chunk), pageOffset);
+          } else {
+            for (var i = 0; i < chunk; i++) {
+              page[pageOffset + i] = buffer[offset + written + i];
+            }
+          }
+          written += chunk;
+        }
+        node.usedBytes = Math.max(node.usedBytes, position + length);
+        return length;
+#else
         if (buffer.subarray && (!node.contents || node.contents.subarray)) { // This write is from a typed array to a typed array?
           if (canOwn) {
 #if ASSERTIONS
@@ -301,6 +418,7 @@ addToLibrary({
         }
         node.usedBytes = Math.max(node.usedBytes, position + length);
         return length;
+#endif // MEMFS_PAGE_SIZE
       },
 
       llseek(stream, offset, whence) {
@@ -319,6 +437,10 @@ addToLibrary({
       },
       allocate(stream, offset, length) {
         MEMFS.expandFileStorage(stream.node, offset + length);
+#if MEMFS_PAGE_SIZE
+        // The contiguous copy of the file no longer has the right size.
+        stream.node.contents = null;
+#endif
         stream.node.usedBytes = Math.max(stream.node.usedBytes, offset + length);
       },
       mmap(stream, length, position, prot, flags) {
@@ -327,6 +449,17 @@ addToLibrary({
         }
         var ptr;
         var allocated;
+#if MEMFS_PAGE_SIZE
+        // Paged files are never backed by the HEAP buffer so we always copy,
+        // straight from the pages without materializing the whole file.
+        allocated = true;
+        ptr = mmapAlloc(length);
+        if (!ptr) {
+          throw new FS.ErrnoError({{{ cDefs.ENOMEM }}});
+        }
+        var size = Math.max(0, Math.min(length, stream.node.usedBytes - position));
+        MEMFS.readPages(stream.node, HEAP8, ptr, size, position);
+#else
         var contents = stream.node.contents;
         // Only make a new copy when MAP_PRIVATE is specified.
         if (!(flags & {{{ cDefs.MAP_PRIVATE }}}) && contents && contents.buffer === HEAP8.buffer) {
@@ -352,6 +485,7 @@ addToLibrary({
             HEAP8.set(contents, ptr);
           }
         }
+#endif // MEMFS_PAGE_SIZE
         return { ptr, allocated };
       },
       msync(stream, buffer, offset, length, mmapFlags) {
@@ -38,6 +38,7 @@ var LibraryPThread = {
                    '$cancelThread', '$cleanupThread', '$zeroMemory',
 #if MAIN_MODULE
                    '$markAsFinished',
+                   '$registerSharedModule',
 #endif
                    '$spawnThread',
                    '_emscripten_thread_free_data',
@@ -45,6 +46,9 @@ var LibraryPThread = {
 #if PTHREADS_DEBUG || ASSERTIONS
                    '$ptrToString',
 #endif
+#if PTHREADS_PROFILING
+                   'emscripten_get_now',
+#endif
 #if !MINIMAL_RUNTIME
                    '$handleException',
 #endif
@@ -63,6 +67,13 @@ var LibraryPThread = {
     // the reverse mapping, each worker has a `pthread_ptr` when its running a
     // pthread.
     pthreads: {},
+#if PTHREAD_POOL_WARM
+    // Number of Workers handed out by getNewWorker since the last refill.  The
+    // size of the last burst of pthread_create calls is used as a prediction
+    // of the next one.
+    recentSpawns: 0,
+    refillTimer: 0,
+#endif
 #if ASSERTIONS
     nextWorkerID: 1,
     debugInit() {
@@ -164,6 +175,62 @@ var LibraryPThread = {
       var status = (profilerBlock == 0) ? 0 : Atomics.load(HEAPU32, {{{ getHeapOffset('profilerBlock + ' + C_STRUCTS.thread_profiler_block.threadStatus, 'i32') }}});
       return PThread.threadStatusToString(status);
     },
+
+    // Timelines of status transitions, copied out of the ring buffers in the
+    // profiler blocks of the threads, keyed by pthread pointer.  When a thread
+    // exits its timeline moves to `finishedProfilerTimelines`, since the
+    // pointer may be reused by a later thread.
+    profilerTimelines: {},
+    finishedProfilerTimelines: [],
+
+    // Copy the status transitions that the given thread has recorded since the
+    // last call into its timeline.  If the thread recorded more transitions
+    // than its ring buffer holds in the meantime, the oldest ones are lost.
+    harvestProfilerEvents(pthreadPtr) {
+      var profilerBlock = {{{ makeGetValue('pthreadPtr', C_STRUCTS.pthread.profilerBlock, '*') }}};
+      if (!profilerBlock) return;
+      var timeline = PThread.profilerTimelines[pthreadPtr];
+      if (!timeline) {
+        timeline = PThread.profilerTimelines[pthreadPtr] = { tid: Number(pthreadPtr), name: '', read: 0, events: [], gaps: [] };
+      }
+      timeline.name = PThread.getThreadName(pthreadPtr) || timeline.name;
+      var countIndex = {{{ getHeapOffset('profilerBlock + ' + C_STRUCTS.thread_profiler_block.eventCount, 'i32') }}};
+      var count = Atomics.load(HEAPU32, countIndex);
+      // The slot after the newest event is the one that the thread writes
+      // next, so it is not safe to read even though it holds the oldest event.
+      var first = Math.max(timeline.read, count - {{{ cDefs.EM_THREAD_PROFILER_EVENTS }}} + 1);
+      var events = [];
+      for (var i = first; i < count; ++i) {
+        var event = profilerBlock + {{{ C_STRUCTS.thread_profiler_block.events }}} + (i % {{{ cDefs.EM_THREAD_PROFILER_EVENTS }}}) * {{{ C_STRUCTS.thread_profiler_event.__size__ }}};
+        events.push({
+          time: {{{ makeGetValue('event', C_STRUCTS.thread_profiler_event.time, 'double') }}},
+          status: {{{ makeGetValue('event', C_STRUCTS.thread_profiler_event.status, 'i32') }}},
+        });
+      }
+      // The thread keeps running while we copy, so drop anything that it may
+      // have overwritten in the meantime.
+      var overwritten = Atomics.load(HEAPU32, countIndex) - {{{ cDefs.EM_THREAD_PROFILER_EVENTS }}} + 1 - first;
+      if (overwritten > 0) {
+        events.splice(0, overwritten);
+        first += overwritten;
+      }
+      if (first > timeline.read) {
+        timeline.gaps.push({ time: events.length ? events[0].time : _emscripten_get_now(), lost: first - timeline.read });
+      }
+      timeline.read = count;
+      for (var e of events) timeline.events.push(e);
+      timeline.end = _emscripten_get_now();
+    },
+
+    // Keep the timeline of an exiting thread before its profiler block is
+    // freed.
+    finishProfilerTimeline(pthreadPtr) {
+      PThread.harvestProfilerEvents(pthreadPtr);
+      if (PThread.profilerTimelines[pthreadPtr]) {
+        PThread.finishedProfilerTimelines.push(PThread.profilerTimelines[pthreadPtr]);
+        delete PThread.profilerTimelines[pthreadPtr];
+      }
+    },
 #endif
 
 #if !MINIMAL_RUNTIME
@@ -193,6 +260,11 @@ var LibraryPThread = {
       PThread.unusedWorkers = [];
       PThread.runningWorkers = [];
       PThread.pthreads = [];
+#if PTHREAD_POOL_WARM
+      // Don't let a pending refill spin up new workers after shutdown.
+      clearTimeout(PThread.refillTimer);
+      PThread.refillTimer = 0;
+#endif
     },
     returnWorkerToPool: (worker) => {
       // We don't want to run main thread queued calls here, since we are doing
@@ -203,6 +275,9 @@ var LibraryPThread = {
       // we are all done.
       var pthread_ptr = worker.pthread_ptr;
       delete PThread.pthreads[pthread_ptr];
+#if PTHREADS_PROFILING
+      PThread.finishProfilerTimeline(pthread_ptr);
+#endif
       // Note: worker is intentionally not terminated so the pool can
       // dynamically grow.
       PThread.unusedWorkers.push(worker);
@@ -276,6 +351,8 @@ var LibraryPThread = {
 #if MAIN_MODULE
         } else if (cmd === 'markAsFinished') {
           markAsFinished(d['thread']);
+        } else if (cmd === 'sharedModule') {
+          registerSharedModule(d['name'], d['module'], worker);
 #endif
         } else if (cmd === 'killThread') {
           killThread(d['thread']);
@@ -283,7 +360,7 @@ var LibraryPThread = {
           cancelThread(d['thread']);
         } else if (cmd === 'loaded') {
           worker.loaded = true;
-#if ENVIRONMENT_MAY_BE_NODE && PTHREAD_POOL_SIZE
+#if ENVIRONMENT_MAY_BE_NODE && (PTHREAD_POOL_SIZE || PTHREAD_POOL_WARM)
           // Check that this worker doesn't have an associated pthread.
           if (ENVIRONMENT_IS_NODE && !worker.pthread_ptr) {
             // Once worker is loaded & idle, mark it as weakly referenced,
@@ -391,6 +468,11 @@ var LibraryPThread = {
     }),
 
     loadWasmModuleToAllWorkers(onMaybeReady) {
+#if PTHREAD_POOL_WARM
+      // Start filling the warm pool in the background.  Startup never waits
+      // for these workers.
+      if (!ENVIRONMENT_IS_PTHREAD) PThread.scheduleRefill();
+#endif
 #if !PTHREAD_POOL_SIZE
       onMaybeReady();
 #else
@@ -485,6 +567,35 @@ var LibraryPThread = {
       PThread.unusedWorkers.push(worker);
     },
 
+#if PTHREAD_POOL_WARM
+    scheduleRefill() {
+      if (!PThread.refillTimer) {
+        PThread.refillTimer = setTimeout(PThread.refillPool, 0);
+      }
+    },
+
+    // Tops up the pool so that there are at least PTHREAD_POOL_WARM idle
+    // workers, or as many as were used by the last burst of thread creation
+    // (capped at twice PTHREAD_POOL_WARM), whichever is larger.  Workers that
+    // are still loading count as idle so that we never over-allocate.
+    refillPool() {
+      PThread.refillTimer = 0;
+      var target = Math.max({{{ PTHREAD_POOL_WARM }}}, Math.min(PThread.recentSpawns, {{{ PTHREAD_POOL_WARM * 2 }}}));
+      PThread.recentSpawns = 0;
+#if PTHREADS_DEBUG
+      dbg(`refillPool: idle=${PThread.unusedWorkers.length} target=${target}`);
+#endif
+      while (PThread.unusedWorkers.length < target) {
+        PThread.allocateUnusedWorker();
+        // Keep loaded workers at the end of the list so that getNewWorker
+        // hands them out before the ones that are still instantiating.
+        var worker = PThread.unusedWorkers.pop();
+        PThread.unusedWorkers.unshift(worker);
+        PThread.loadWasmModuleToWorker(worker);
+      }
+    },
+#endif
+
     getNewWorker() {
       if (PThread.unusedWorkers.length == 0) {
 // PTHREAD_POOL_SIZE_STRICT should show a warning and, if set to level `2`, return from the function.
@@ -515,6 +626,10 @@ var LibraryPThread = {
         PThread.loadWasmModuleToWorker(PThread.unusedWorkers[0]);
 #endif
       }
+#if PTHREAD_POOL_WARM
+      PThread.recentSpawns++;
+      PThread.scheduleRefill();
+#endif
       return PThread.unusedWorkers.pop();
     }
   },
@@ -549,6 +664,9 @@ var LibraryPThread = {
     var worker = PThread.pthreads[pthread_ptr];
     delete PThread.pthreads[pthread_ptr];
     terminateWorker(worker);
+#if PTHREADS_PROFILING
+    PThread.finishProfilerTimeline(pthread_ptr);
+#endif
     __emscripten_thread_free_data(pthread_ptr);
     // The worker was completely nuked (not just the pthread execution it was hosting), so remove it from running workers
     // but don't put it back to the pool.
@@ -0,0 +1,112 @@
+/**
+ * @license
+ * Copyright 2024 The Emscripten Authors
+ * SPDX-License-Identifier: MIT
+ */
+
+// Sampling CPU profiler for Node.js, see SAMPLING_PROFILER in settings.js.
+//
+// This drives the sampling profiler of V8 through the in-process inspector
+// session, which does not need devtools to be attached. Every few seconds the
+// samples that V8 collected are folded into a map from stack to sample count,
+// so that memory use depends on the number of distinct stacks rather than on
+// how long the program runs.
+
+addToLibrary({
+  $samplingProfiler__postset: () => {
+    var cond = 'ENVIRONMENT_IS_NODE';
+#if PTHREADS
+    cond += ' && !ENVIRONMENT_IS_PTHREAD';
+#endif
+    return `if (${cond}) samplingProfiler.start();`;
+  },
+  $samplingProfiler: {
+    // How often to fold the collected samples, in milliseconds.
+    collectIntervalMsecs: 10000,
+
+    session: null,
+    stacks: null,
+
+    start() {
+      var session = new (require('inspector').Session)();
+      session.connect();
+      session.post('Profiler.enable');
+      session.post('Profiler.setSamplingInterval', { interval: {{{ SAMPLING_PROFILER_INTERVAL }}} });
+      session.post('Profiler.start');
+      samplingProfiler.session = session;
+      samplingProfiler.stacks = new Map();
+      setInterval(samplingProfiler.collect, samplingProfiler.collectIntervalMsecs).unref();
+      // Neither of these keeps the process alive.
+      process.on('SIGUSR2', () => samplingProfiler.write());
+      process.on('exit', () => samplingProfiler.write());
+    },
+
+    // Returns the name of the frame in folded stacks, or null to leave it out.
+    frameName(callFrame) {
+      var name = callFrame.functionName;
+      if (name == '(root)' || name == '(idle)') {
+        return null;
+      }
+      // Leave out the wrappers that V8 inserts at the boundary between JS and
+      // wasm.
+      if (/^(js-to-wasm|wasm-to-js|GenericJSToWasmWrapper)/.test(name)) {
+        return null;
+      }
+      // Wasm functions are reported under their name from the name section,
+      // which V8 prefixes with `$`, or as `wasm-function[N]` if they have none.
+      if (callFrame.url.startsWith('wasm://')) {
+        name = name.replace(/^\$/, '');
+      }
+      return name || '(anonymous)';
+    },
+
+    // Add the samples of a V8 CPU profile to `stacks`.
+    fold(profile) {
+      var nodes = {};
+      var parents = {};
+      for (var node of profile.nodes) {
+        nodes[node.id] = node;
+        for (var child of node.children || []) {
+          parents[child] = node.id;
+        }
+      }
+      var folded = {};
+      var stackOf = (id) => {
+        if (id === undefined) return '';
+        if (!(id in folded)) {
+          var parent = stackOf(parents[id]);
+          var name = samplingProfiler.frameName(nodes[id].callFrame);
+          folded[id] = (name === null) ? parent : (parent ? `${parent};${name}` : name);
+        }
+        return folded[id];
+      };
+      for (var id of profile.samples) {
+        var stack = stackOf(id);
+        if (stack) {
+          samplingProfiler.stacks.set(stack, (samplingProfiler.stacks.get(stack) || 0) + 1);
+        }
+      }
+    },
+
+    // Fold the samples collected since the last call, and keep sampling.
+    collect() {
+      var session = samplingProfiler.session;
+      session.post('Profiler.stop', (err, result) => {
+        if (!err) samplingProfiler.fold(result.profile);
+      });
+      session.post('Profiler.start');
+    },
+
+    // Write all the samples so far as folded stacks, one `frame;frame;frame
+    // count` line per distinct stack.
+    write(filename) {
+      filename ||= Module['samplingProfilerFile'] || 'profile.folded';
+      samplingProfiler.collect();
+      var lines = [];
+      for (var [stack, count] of samplingProfiler.stacks) {
+        lines.push(`${stack} ${count}\n`);
+      }
+      require('fs').writeFileSync(filename, lines.join(''));
+    },
+  },
+});
@@ -321,6 +321,7 @@ sigs = {
   _emscripten_fetch_get_response_headers__sig: 'pipp',
   _emscripten_fetch_get_response_headers_length__sig: 'pi',
   _emscripten_fs_load_embedded_files__sig: 'vp',
+  _emscripten_get_heap_view_refreshes__sig: 'i',
   _emscripten_get_now_is_monotonic__sig: 'i',
   _emscripten_get_progname__sig: 'vpi',
   _emscripten_init_main_thread_js__sig: 'vp',
@@ -388,6 +389,7 @@ sigs = {
   _wasmfs_copy_preloaded_file_data__sig: 'vip',
   _wasmfs_create_fetch_backend_js__sig: 'vp',
   _wasmfs_create_js_file_backend_js__sig: 'vp',
+  _wasmfs_get_io_thread_count__sig: 'i',
   _wasmfs_get_num_preloaded_dirs__sig: 'i',
   _wasmfs_get_num_preloaded_files__sig: 'i',
   _wasmfs_get_preloaded_child_path__sig: 'vip',
@@ -412,12 +414,15 @@ sigs = {
   _wasmfs_node_insert_directory__sig: 'ipi',
   _wasmfs_node_insert_file__sig: 'ipi',
   _wasmfs_node_open__sig: 'ipp',
-  _wasmfs_node_read__sig: 'iipiip',
+  _wasmfs_node_read__sig: 'iippjp',
   _wasmfs_node_readdir__sig: 'ipp',
+  _wasmfs_node_readdir_attrs__sig: 'ippp',
+  _wasmfs_node_readv__sig: 'iippjp',
   _wasmfs_node_rmdir__sig: 'ip',
   _wasmfs_node_stat_size__sig: 'ipp',
   _wasmfs_node_unlink__sig: 'ip',
-  _wasmfs_node_write__sig: 'iipiip',
+  _wasmfs_node_write__sig: 'iippjp',
+  _wasmfs_node_writev__sig: 'iippjp',
   _wasmfs_opfs_close_access__sig: 'vpip',
   _wasmfs_opfs_close_blob__sig: 'vi',
   _wasmfs_opfs_flush_access__sig: 'vpip',
@@ -425,6 +430,7 @@ sigs = {
   _wasmfs_opfs_free_file__sig: 'vi',
   _wasmfs_opfs_get_child__sig: 'vpippp',
   _wasmfs_opfs_get_entries__sig: 'vpipp',
+  _wasmfs_opfs_get_entries_attrs__sig: 'vpippp',
   _wasmfs_opfs_get_size_access__sig: 'vpip',
   _wasmfs_opfs_get_size_blob__sig: 'ii',
   _wasmfs_opfs_get_size_file__sig: 'vpip',
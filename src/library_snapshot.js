@@ -0,0 +1,189 @@
+/**
+ * @license
+ * Copyright 2024 The Emscripten Authors
+ * SPDX-License-Identifier: MIT
+ */
+
+// Support for MEMORY_SNAPSHOT: the program is run once under node at link time
+// up to the point where main() would be called, and its linear memory and
+// in-memory filesystem are saved to a side file.  Normal runs load that file
+// and restore the state from it, instead of running the static constructors
+// and loading the preloaded files again.
+//
+// Snapshot layout (little endian):
+//   u32 magic, u32 header length, JSON header, memory image, file contents.
+
+#if MEMORY_SNAPSHOT
+addToLibrary({
+  $SNAPSHOT_MAGIC: 0x70616e73, // 'snap'
+
+  // The loaded snapshot, until it has been restored.
+  $snapshotData: null,
+
+  // The size of the table when the static constructors started running.
+  $snapshotTableSize: 0,
+
+  $loadSnapshot__deps: ['$snapshotData'],
+  $loadSnapshot__postset: 'loadSnapshot();',
+  $loadSnapshot: () => {
+    if (Module['takeSnapshot']) {
+      // This is the run that creates the snapshot.
+      return;
+    }
+    addRunDependency('loadSnapshot');
+    readAsync(locateFile('{{{ MEMORY_SNAPSHOT_FILE }}}')).then((data) => {
+      snapshotData = new Uint8Array(data);
+      removeRunDependency('loadSnapshot');
+    }, (e) => abort(`failed to load memory snapshot: ${e}`));
+  },
+
+  // Called instead of the static constructors.
+  $initFromSnapshot__deps: ['$snapshotData', '$snapshotTableSize', '$restoreSnapshot', '$wasmTable', '$getEnvStrings'],
+  $initFromSnapshot: () => {
+    if (snapshotData) {
+      restoreSnapshot(snapshotData);
+      snapshotData = null;
+#if hasExportedSymbol('__emscripten_environ_constructor')
+      // The environment in the snapshot is the one of the node process that
+      // took it.  Read it again, so that the defaults for this environment
+      // and changes to ENV made in preRun are seen.
+      getEnvStrings.strings = null;
+      wasmExports['__emscripten_environ_constructor']();
+#endif
+      return;
+    }
+    snapshotTableSize = wasmTable.length;
+#if hasExportedSymbol('__wasm_call_ctors')
+    wasmExports['__wasm_call_ctors']();
+#endif
+  },
+
+#if FILESYSTEM && !WASMFS && !NODERAWFS
+  // Lists the contents of the in-memory filesystem.  Other filesystems (such
+  // as NODEFS mounts) and devices are left out, since they are set up again
+  // at startup.
+  $snapshotFiles__deps: ['$FS', '$MEMFS', '$PATH'],
+  $snapshotFiles: () => {
+    var entries = [];
+    var visit = (path) => {
+      var node = FS.lookupPath(path, { follow: false }).node;
+      if (node.mount.type !== MEMFS) return;
+      var stat = FS.lstat(path);
+      var entry = { path, mode: stat.mode, mtime: stat.mtime.getTime() };
+      if (FS.isDir(stat.mode)) {
+        entries.push(entry);
+        for (var name of FS.readdir(path)) {
+          if (name != '.' && name != '..') visit(PATH.join2(path, name));
+        }
+      } else if (FS.isFile(stat.mode)) {
+        entry.data = FS.readFile(path);
+        entries.push(entry);
+      } else if (FS.isLink(stat.mode)) {
+        entry.link = FS.readlink(path);
+        entries.push(entry);
+      }
+    };
+    visit('/');
+    return entries;
+  },
+
+  $restoreFiles__deps: ['$FS'],
+  $restoreFiles: (entries, data, offset) => {
+    for (var entry of entries) {
+      var path = entry.path;
+      var existing = FS.analyzePath(path, true);
+      if (FS.isDir(entry.mode)) {
+        if (!existing.exists) FS.mkdir(path, entry.mode);
+        continue;
+      }
+      // Files in the snapshot replace any that startup code created.
+      if (existing.exists) FS.unlink(path);
+      if (entry.link !== undefined) {
+        FS.symlink(entry.link, path);
+        continue;
+      }
+      FS.writeFile(path, data.subarray(offset, offset + entry.size), { canOwn: true });
+      offset += entry.size;
+      FS.chmod(path, entry.mode);
+      FS.utime(path, entry.mtime, entry.mtime);
+    }
+  },
+#endif
+
+  // Returns the state of the program as a Uint8Array.  This must be called
+  // after the static constructors have run, and before main().
+  $takeSnapshot__deps: ['$SNAPSHOT_MAGIC', '$snapshotTableSize', '$wasmTable', 'sbrk',
+#if FILESYSTEM && !WASMFS && !NODERAWFS
+    '$snapshotFiles',
+#endif
+  ],
+  $takeSnapshot: () => {
+    // Functions added to the table from JS cannot be serialized.
+    if (wasmTable.length != snapshotTableSize) {
+      abort('cannot take a memory snapshot after functions were added to the table');
+    }
+    // Nothing above the current break is in use.
+#if MEMORY64
+    var memoryEnd = _sbrk(0);
+#else
+    var memoryEnd = _sbrk(0) >>> 0;
+#endif
+    var header = { memorySize: HEAPU8.length, memoryEnd, files: [] };
+    var chunks = [HEAPU8.subarray(0, memoryEnd)];
+#if FILESYSTEM && !WASMFS && !NODERAWFS
+    for (var entry of snapshotFiles()) {
+      if (entry.data) {
+        chunks.push(entry.data);
+        entry.size = entry.data.length;
+        delete entry.data;
+      }
+      header.files.push(entry);
+    }
+#endif
+    var json = new TextEncoder().encode(JSON.stringify(header));
+    var size = 8 + json.length + chunks.reduce((total, c) => total + c.length, 0);
+    var result = new Uint8Array(size);
+    var view = new DataView(result.buffer);
+    view.setUint32(0, SNAPSHOT_MAGIC, true);
+    view.setUint32(4, json.length, true);
+    result.set(json, 8);
+    var offset = 8 + json.length;
+    for (var c of chunks) {
+      result.set(c, offset);
+      offset += c.length;
+    }
+    return result;
+  },
+
+  $restoreSnapshot__deps: ['$SNAPSHOT_MAGIC',
+#if ALLOW_MEMORY_GROWTH
+    '$growMemory',
+#endif
+#if FILESYSTEM && !WASMFS && !NODERAWFS
+    '$restoreFiles',
+#endif
+  ],
+  $restoreSnapshot: (data) => {
+    var view = new DataView(data.buffer, data.byteOffset, data.byteLength);
+    if (view.getUint32(0, true) != SNAPSHOT_MAGIC) {
+      abort('invalid memory snapshot');
+    }
+    var jsonLength = view.getUint32(4, true);
+    var header = JSON.parse(new TextDecoder().decode(data.subarray(8, 8 + jsonLength)));
+    var offset = 8 + jsonLength;
+    if (header.memorySize > HEAPU8.length) {
+#if ALLOW_MEMORY_GROWTH
+      if (!growMemory(header.memorySize))
+#endif
+      abort(`memory snapshot needs ${header.memorySize} bytes of memory`);
+    }
+    // Memory above the break is unused, and zero both now and when the
+    // snapshot was taken, so only the part below it is stored.
+    HEAPU8.set(data.subarray(offset, offset + header.memoryEnd));
+    offset += header.memoryEnd;
+#if FILESYSTEM && !WASMFS && !NODERAWFS
+    restoreFiles(header.files, data, offset);
+#endif
+  },
+});
+#endif
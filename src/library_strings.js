@@ -10,8 +10,10 @@ addToLibrary({
   // TextDecoder constructor defaults to UTF-8
 #if TEXTDECODER == 2
   $UTF8Decoder: "new TextDecoder()",
+  $UTF8Encoder: "new TextEncoder()",
 #elif TEXTDECODER == 1
   $UTF8Decoder: "typeof TextDecoder != 'undefined' ? new TextDecoder() : undefined",
+  $UTF8Encoder: "typeof TextEncoder != 'undefined' ? new TextEncoder() : undefined",
 #endif
 
   $UTF8ArrayToString__docs: `
@@ -110,7 +112,17 @@ addToLibrary({
    *   JS JIT optimizations off, so it is worth to consider consistently using one
    * @return {string}
    */`,
-#if TEXTDECODER == 2
+#if SIMD_STRINGS
+  $UTF8ToString__deps: [
+#if TEXTDECODER
+    '$UTF8Decoder',
+#endif
+#if TEXTDECODER != 2
+    '$UTF8ArrayToString', '_emscripten_utf8_to_utf16', 'malloc', 'free',
+#endif
+    '_emscripten_utf8_length',
+  ],
+#elif TEXTDECODER == 2
   $UTF8ToString__deps: ['$UTF8Decoder'],
 #else
   $UTF8ToString__deps: ['$UTF8ArrayToString'],
@@ -122,7 +134,41 @@ addToLibrary({
 #if CAN_ADDRESS_2GB
     ptr >>>= 0;
 #endif
+#if SIMD_STRINGS
+    if (!ptr) return '';
+    var maxPtr = ptr + maxBytesToRead;
+    // Look for the end of short strings here, and leave the rest of long ones
+    // to the SIMD scan in wasm.  (If maxBytesToRead is undefined then maxPtr is
+    // NaN, which never compares as reached.)
+    for (var end = ptr; end - ptr < 16 && !(end >= maxPtr) && HEAPU8[end];) ++end;
+    if (end - ptr == 16 && !(end >= maxPtr)) {
+      end += _emscripten_utf8_length(end, maxPtr - end || -1);
+    }
 #if TEXTDECODER == 2
+    return UTF8Decoder.decode({{{ getUnsharedTextDecoderView('HEAPU8', 'ptr', 'end') }}});
+#else
+#if TEXTDECODER
+    if (end - ptr > 16 && UTF8Decoder) {
+      return UTF8Decoder.decode({{{ getUnsharedTextDecoderView('HEAPU8', 'ptr', 'end') }}});
+    }
+#endif
+    // Without TextDecoder, have wasm convert long strings to UTF-16 and build
+    // the result from that in chunks.  This decodes exactly like
+    // UTF8ArrayToString.
+    var buf;
+    if (end - ptr > 64 && (buf = _malloc((end - ptr + 1) * 2))) {
+      var units = _emscripten_utf8_to_utf16(ptr, end - ptr, buf);
+      var idx = {{{ getHeapOffset('buf', 'i16') }}};
+      var str = '';
+      for (var i = 0; i < units; i += 4096) {
+        str += String.fromCharCode.apply(null, HEAPU16.subarray(idx + i, idx + Math.min(i + 4096, units)));
+      }
+      _free(buf);
+      return str;
+    }
+    return UTF8ArrayToString(HEAPU8, ptr, end - ptr);
+#endif
+#elif TEXTDECODER == 2
     if (!ptr) return '';
     var maxPtr = ptr + maxBytesToRead;
     for (var end = ptr; !(end >= maxPtr) && HEAPU8[end];) ++end;
@@ -218,10 +264,30 @@ addToLibrary({
    *
    * @return {number} The number of bytes written, EXCLUDING the null terminator.
    */
+#if SIMD_STRINGS && TEXTDECODER && !SHARED_MEMORY
+  $stringToUTF8__deps: ['$stringToUTF8Array', '$UTF8Encoder'],
+#else
   $stringToUTF8__deps: ['$stringToUTF8Array'],
+#endif
   $stringToUTF8: (str, outPtr, maxBytesToWrite) => {
 #if ASSERTIONS
     assert(typeof maxBytesToWrite == 'number', 'stringToUTF8(str, outPtr, maxBytesToWrite) is missing the third parameter that specifies the length of the output buffer!');
+#endif
+#if SIMD_STRINGS && TEXTDECODER && !SHARED_MEMORY
+    // Let TextEncoder write long strings straight into the heap.  encodeInto
+    // stops before a character that does not fit, like stringToUTF8Array, but
+    // replaces lone surrogates with U+FFFD, so strings that have them (or
+    // where that cannot be checked) are left to stringToUTF8Array.  This is
+    // part of the -msimd128 string handling so that it doesn't add to the size
+    // of other builds, where stringToUTF8 is used by callMain.
+    if (str.length > 16 && maxBytesToWrite > 0{{{ TEXTDECODER == 1 ? ' && UTF8Encoder' : '' }}} && str.isWellFormed?.()) {
+#if CAN_ADDRESS_2GB
+      outPtr >>>= 0;
+#endif
+      var written = UTF8Encoder.encodeInto(str, HEAPU8.subarray(outPtr, outPtr + maxBytesToWrite - 1)).written;
+      HEAPU8[outPtr + written] = 0;
+      return written;
+    }
 #endif
     return stringToUTF8Array(str, HEAPU8, outPtr, maxBytesToWrite);
   },
@@ -298,7 +364,11 @@ addToLibrary({
   // emscripten HEAP, returns a copy of that string as a Javascript String
   // object.
 #if TEXTDECODER
-  $UTF16ToString__deps: ['$UTF16Decoder'],
+  $UTF16ToString__deps: ['$UTF16Decoder',
+#if SIMD_STRINGS
+    '_emscripten_utf16_length',
+#endif
+  ],
 #endif
   $UTF16ToString: (ptr, maxBytesToRead) => {
 #if ASSERTIONS
@@ -314,7 +384,15 @@ addToLibrary({
     var maxIdx = idx + maxBytesToRead / 2;
     // If maxBytesToRead is not passed explicitly, it will be undefined, and this
     // will always evaluate to true. This saves on code size.
+#if SIMD_STRINGS
+    // Long strings are scanned in wasm after the first 16 code units.
+    while (idx - (ptr >> 1) < 16 && !(idx >= maxIdx) && HEAPU16[idx]) ++idx;
+    if (idx - (ptr >> 1) == 16 && !(idx >= maxIdx)) {
+      idx += _emscripten_utf16_length(idx << 1, Math.ceil(maxIdx - idx) || -1);
+    }
+#else
     while (!(idx >= maxIdx) && HEAPU16[idx]) ++idx;
+#endif
     endPtr = idx << 1;
 
 #if TEXTDECODER != 2
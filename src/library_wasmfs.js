@@ -615,6 +615,8 @@ FS.init();
   _wasmfs_copy_preloaded_file_data: (index, buffer) =>
     HEAPU8.set(wasmFSPreloadedFiles[index].fileData, buffer),
 
+  _wasmfs_get_io_thread_count: () => {{{ WASMFS_IO_THREADS }}},
+
   _wasmfs_thread_utils_heartbeat__deps: ['emscripten_proxy_execute_queue'],
   _wasmfs_thread_utils_heartbeat: (queue) => {
     var intervalID =
@@ -60,11 +60,23 @@ addToLibrary({
     return wasmfsNodeFixStat(stat);
   },
 
+  $wasmfsNodeDirentKind: (entry) => {
+    if (entry.isFile()) {
+      return {{{ cDefine('File::DataFileKind') }}};
+    } else if (entry.isDirectory()) {
+      return {{{ cDefine('File::DirectoryKind') }}};
+    } else if (entry.isSymbolicLink()) {
+      return {{{ cDefine('File::SymlinkKind') }}};
+    }
+    return {{{ cDefine('File::UnknownKind') }}};
+  },
+
   // Ignore closure type errors due to outdated readdirSync annotations, see
   // https://github.com/google/closure-compiler/pull/4093
   _wasmfs_node_readdir__docs: '/** @suppress {checkTypes} */',
   _wasmfs_node_readdir__deps: [
     '$wasmfsTry',
+    '$wasmfsNodeDirentKind',
     '$stackSave',
     '$stackRestore',
     '$stringToUTF8OnStack',
@@ -77,17 +89,49 @@ addToLibrary({
       entries.forEach((entry) => {
         let sp = stackSave();
         let name = stringToUTF8OnStack(entry.name);
-        let type;
-        if (entry.isFile()) {
-          type = {{{ cDefine('File::DataFileKind') }}};
-        } else if (entry.isDirectory()) {
-          type = {{{ cDefine('File::DirectoryKind') }}};
-        } else if (entry.isSymbolicLink()) {
-          type = {{{ cDefine('File::SymlinkKind') }}};
+        __wasmfs_node_record_dirent(vec, name, wasmfsNodeDirentKind(entry));
+        stackRestore(sp);
+        // implicitly return 0
+      });
+    });
+  },
+
+  // Like _wasmfs_node_readdir, but also lstat each regular file and directory
+  // that WasmFS has not looked up yet and report its attributes, so that the
+  // whole listing takes a single call from Wasm.
+  _wasmfs_node_readdir_attrs__docs: '/** @suppress {checkTypes} */',
+  _wasmfs_node_readdir_attrs__deps: [
+    '$wasmfsTry',
+    '$wasmfsNodeDirentKind',
+    '$wasmfsNodeLstat',
+    '$stackSave',
+    '$stackRestore',
+    '$stringToUTF8OnStack',
+    '_wasmfs_node_record_dirent',
+    '_wasmfs_node_record_dirent_attrs',
+    '_wasmfs_node_is_child_cached',
+  ],
+  _wasmfs_node_readdir_attrs: (path_p, dir, vec) => {
+    let path = UTF8ToString(path_p);
+    return wasmfsTry(() => {
+      let entries = fs.readdirSync(path, { withFileTypes: true });
+      entries.forEach((entry) => {
+        let sp = stackSave();
+        let name = stringToUTF8OnStack(entry.name);
+        let stat;
+        if ((entry.isFile() || entry.isDirectory()) &&
+            !__wasmfs_node_is_child_cached(dir, name)) {
+          stat = wasmfsNodeLstat(path + '/' + entry.name);
+        }
+        if (stat) {
+          __wasmfs_node_record_dirent_attrs(vec, dir, name, stat.mode, stat.size,
+                                            stat.atimeMs, stat.mtimeMs, stat.ctimeMs);
         } else {
-          type = {{{ cDefine('File::UnknownKind') }}};
+          // Other kinds of entries are looked up as usual, and so are entries
+          // that are already known or that were removed before they could be
+          // stat-ed.
+          __wasmfs_node_record_dirent(vec, name, wasmfsNodeDirentKind(entry));
         }
-        __wasmfs_node_record_dirent(vec, name, type);
         stackRestore(sp);
         // implicitly return 0
       });
@@ -110,7 +154,7 @@ addToLibrary({
     if (stat === undefined) {
       return 1;
     }
-    {{{ makeSetValue('size_p', 0, 'stat.size', 'i32') }}};
+    {{{ makeSetValue('size_p', 0, 'stat.size', 'i64') }}};
     // implicitly return 0
   },
 
@@ -120,7 +164,7 @@ addToLibrary({
     if (stat === undefined) {
       return 1;
     }
-    {{{ makeSetValue('size_p', 0, 'stat.size', 'i32') }}};
+    {{{ makeSetValue('size_p', 0, 'stat.size', 'i64') }}};
     // implicitly return 0
   },
 
@@ -171,24 +215,86 @@ addToLibrary({
     });
   },
 
-  _wasmfs_node_read__deps: ['$wasmfsTry'],
-  _wasmfs_node_read: (fd, buf_p, len, pos, nread_p) => {
-    return wasmfsTry(() => {
+  // Views of the wasm memory described by an array of iovecs, which node reads
+  // into or writes from directly, without any intermediate copies. Empty
+  // buffers are skipped.
+  $wasmfsNodeIovecViews: (iovs, iovcnt) => {
+    let views = [];
+    for (let i = 0; i < iovcnt; i++) {
+      let iov = iovs + i * {{{ C_STRUCTS.iovec.__size__ }}};
+      let base = {{{ makeGetValue('iov', C_STRUCTS.iovec.iov_base, '*') }}};
+      let len = {{{ makeGetValue('iov', C_STRUCTS.iovec.iov_len, '*') }}};
+      if (len) {
+        views.push(HEAPU8.subarray(base, base + len));
+      }
+    }
+    return views;
+  },
+
+  // Transfer the data in `views` with `fs.readvSync` or `fs.writevSync`,
+  // starting at `pos`. Node transfers at most 2GB per call, so keep going until
+  // all the data has been transferred or we reach the end of the file.
+  $wasmfsNodeTransferv: (transfer, fd, views, pos) => {
+    let total = 0;
+    while (views.length) {
       // TODO: Cache open file descriptors to guarantee that opened files will
       // still exist when we try to access them.
-      let nread = fs.readSync(fd, new Int8Array(HEAPU8.buffer, buf_p, len), 0, len, pos);
-      {{{ makeSetValue('nread_p', 0, 'nread', 'i32') }}};
+      let n = transfer(fd, views, pos + total);
+      if (!n) {
+        break;
+      }
+      total += n;
+      while (views.length && n >= views[0].length) {
+        n -= views[0].length;
+        views.shift();
+      }
+      if (n) {
+        views[0] = views[0].subarray(n);
+      }
+    }
+    return total;
+  },
+
+  _wasmfs_node_read__i53abi: true,
+  _wasmfs_node_read__deps: ['$wasmfsTry', '$wasmfsNodeTransferv'],
+  _wasmfs_node_read: (fd, buf_p, len, pos, nread_p) => {
+    return wasmfsTry(() => {
+      let views = len ? [HEAPU8.subarray(buf_p, buf_p + len)] : [];
+      let nread = wasmfsNodeTransferv(fs.readvSync, fd, views, pos);
+      {{{ makeSetValue('nread_p', 0, 'nread', '*') }}};
       // implicitly return 0
     });
   },
 
-  _wasmfs_node_write__deps : ['$wasmfsTry'],
+  _wasmfs_node_write__i53abi: true,
+  _wasmfs_node_write__deps : ['$wasmfsTry', '$wasmfsNodeTransferv'],
   _wasmfs_node_write : (fd, buf_p, len, pos, nwritten_p) => {
     return wasmfsTry(() => {
-      // TODO: Cache open file descriptors to guarantee that opened files will
-      // still exist when we try to access them.
-      let nwritten = fs.writeSync(fd, new Int8Array(HEAPU8.buffer, buf_p, len), 0, len, pos);
-      {{{ makeSetValue('nwritten_p', 0, 'nwritten', 'i32') }}};
+      let views = len ? [HEAPU8.subarray(buf_p, buf_p + len)] : [];
+      let nwritten = wasmfsNodeTransferv(fs.writevSync, fd, views, pos);
+      {{{ makeSetValue('nwritten_p', 0, 'nwritten', '*') }}};
+      // implicitly return 0
+    });
+  },
+
+  _wasmfs_node_readv__i53abi: true,
+  _wasmfs_node_readv__deps: ['$wasmfsTry', '$wasmfsNodeIovecViews', '$wasmfsNodeTransferv'],
+  _wasmfs_node_readv: (fd, iovs, iovcnt, pos, nread_p) => {
+    return wasmfsTry(() => {
+      let views = wasmfsNodeIovecViews(iovs, iovcnt);
+      let nread = wasmfsNodeTransferv(fs.readvSync, fd, views, pos);
+      {{{ makeSetValue('nread_p', 0, 'nread', '*') }}};
+      // implicitly return 0
+    });
+  },
+
+  _wasmfs_node_writev__i53abi: true,
+  _wasmfs_node_writev__deps: ['$wasmfsTry', '$wasmfsNodeIovecViews', '$wasmfsNodeTransferv'],
+  _wasmfs_node_writev: (fd, iovs, iovcnt, pos, nwritten_p) => {
+    return wasmfsTry(() => {
+      let views = wasmfsNodeIovecViews(iovs, iovcnt);
+      let nwritten = wasmfsNodeTransferv(fs.writevSync, fd, views, pos);
+      {{{ makeSetValue('nwritten_p', 0, 'nwritten', '*') }}};
       // implicitly return 0
     });
   },
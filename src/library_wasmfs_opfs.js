@@ -178,6 +178,64 @@ addToLibrary({
     wasmfsOPFSProxyFinish(ctx);
   },
 
+  // Like _wasmfs_opfs_get_entries, but also allocate a handle ID for each child
+  // that WasmFS has not looked up yet and look up the sizes and modification
+  // times of those files, so that the whole listing takes a single proxied
+  // call.
+  _wasmfs_opfs_get_entries_attrs__deps: [
+    '$wasmfsOPFSDirectoryHandles',
+    '$wasmfsOPFSFileHandles',
+    '$wasmfsOPFSProxyFinish',
+    '$stackSave',
+    '$stackRestore',
+    '_wasmfs_opfs_record_entry',
+    '_wasmfs_opfs_record_entry_attrs',
+    '_wasmfs_opfs_is_child_cached',
+  ],
+  _wasmfs_opfs_get_entries_attrs: async function(ctx, dirID, dir, entriesPtr, errPtr) {
+    let dirHandle = wasmfsOPFSDirectoryHandles.get(dirID);
+
+    try {
+      let children = [];
+      let iter = dirHandle.entries();
+      for (let entry; entry = await iter.next(), !entry.done;) {
+        let [name, child] = entry.value;
+        let sp = stackSave();
+        let cached = __wasmfs_opfs_is_child_cached(dir, stringToUTF8OnStack(name));
+        stackRestore(sp);
+        children.push([name, child, cached]);
+      }
+      // Query the files concurrently rather than one at a time.
+      let files = await Promise.all(children.map(([name, child, cached]) =>
+        !cached && child.kind == "file" ? child.getFile().catch(() => null) : null));
+      children.forEach(([name, child, cached], i) => {
+        let sp = stackSave();
+        let namePtr = stringToUTF8OnStack(name);
+        if (cached) {
+          let type = child.kind == "file" ?
+              {{{ cDefine('File::DataFileKind') }}} :
+              {{{ cDefine('File::DirectoryKind') }}};
+          __wasmfs_opfs_record_entry(entriesPtr, namePtr, type);
+        } else if (child.kind == "directory") {
+          let id = wasmfsOPFSDirectoryHandles.allocate(child);
+          __wasmfs_opfs_record_entry_attrs(entriesPtr, dir, namePtr, 2, id, 0, 0);
+        } else if (files[i]) {
+          let id = wasmfsOPFSFileHandles.allocate(child);
+          __wasmfs_opfs_record_entry_attrs(entriesPtr, dir, namePtr, 1, id,
+                                           files[i].size, files[i].lastModified);
+        } else {
+          // The file could not be read, so leave it to be looked up normally.
+          __wasmfs_opfs_record_entry(entriesPtr, namePtr, {{{ cDefine('File::DataFileKind') }}});
+        }
+        stackRestore(sp);
+      });
+    } catch {
+      let err = -{{{ cDefs.EIO }}};
+      {{{ makeSetValue('errPtr', 0, 'err', 'i32') }}};
+    }
+    wasmfsOPFSProxyFinish(ctx);
+  },
+
   _wasmfs_opfs_insert_file__deps: ['$wasmfsOPFSGetOrCreateFile', '$wasmfsOPFSProxyFinish'],
   _wasmfs_opfs_insert_file: async function(ctx, parent, namePtr, childIDPtr) {
     let name = UTF8ToString(namePtr);
@@ -204,6 +204,11 @@ for (/**@suppress{duplicate}*/var i = 0; i <= {{{ GL_POOL_TEMP_BUFFERS_SIZE }}};
   $GLctx: undefined,
   $GL__deps: [
     '$GLctx',
+#if GROWABLE_ARRAYBUFFERS && !INCLUDE_FULL_LIBRARY
+    // WebGL does not accept views on a resizable buffer, and the HEAP* views
+    // passed to it would need to be copied on every call.
+    () => error('WebGL is not supported with GROWABLE_ARRAYBUFFERS, since WebGL does not accept views of the resizable heap buffer'),
+#endif
 #if GL_SUPPORT_AUTOMATIC_ENABLE_EXTENSIONS
   // If GL_SUPPORT_AUTOMATIC_ENABLE_EXTENSIONS is enabled, GL.initExtensions() will call to initialize these.
 #if PTHREADS
@@ -521,6 +526,105 @@ for (/**@suppress{duplicate}*/var i = 0; i <= {{{ GL_POOL_TEMP_BUFFERS_SIZE }}};
 
     usedTempBuffers: [],
 
+#if GL_CLIENT_ARRAY_RING_BUFFER_SIZE
+    // Client-side vertex arrays are streamed into a single large ring buffer
+    // per context.  All the client attributes of a draw call are uploaded with
+    // one bufferSubData, and successive draws append to the same buffer
+    // instead of each attribute getting its own temp buffer.  The buffer is
+    // never orphaned; wrapping around only overwrites data that was uploaded
+    // GL_CLIENT_ARRAY_RING_BUFFER_SIZE bytes earlier.
+    clientArrayAttribs: [],
+    clientArrayStaging: null,
+
+    // Reserves `length` bytes in the ring buffer of the current context and
+    // returns the (8 byte aligned) offset.
+    allocClientArrayRingSpace: (length) => {
+      var ctx = GL.currentContext;
+      if (!ctx.clientArrayRingBuffer || length > ctx.clientArrayRingSize) {
+        // Grow to fit, this only happens for draws larger than the configured
+        // size.
+        ctx.clientArrayRingSize = Math.max(ctx.clientArrayRingSize || {{{ GL_CLIENT_ARRAY_RING_BUFFER_SIZE }}}, 1 << GL.log2ceilLookup(length));
+        if (ctx.clientArrayRingBuffer) GLctx.deleteBuffer(ctx.clientArrayRingBuffer);
+        ctx.clientArrayRingBuffer = GLctx.createBuffer();
+        GLctx.bindBuffer(0x8892 /*GL_ARRAY_BUFFER*/, ctx.clientArrayRingBuffer);
+        GLctx.bufferData(0x8892 /*GL_ARRAY_BUFFER*/, ctx.clientArrayRingSize, 0x88E0 /*GL_STREAM_DRAW*/);
+        ctx.clientArrayRingHead = 0;
+      }
+      var offset = (ctx.clientArrayRingHead + 7) & ~7;
+      if (offset + length > ctx.clientArrayRingSize) offset = 0;
+      ctx.clientArrayRingHead = offset + length;
+      return offset;
+    },
+
+    preDrawHandleClientVertexAttribBindings: (count) => {
+      GL.resetBufferBinding = false;
+
+      // First pass: find the client-side attributes and the memory range they
+      // span.
+      var attribs = GL.clientArrayAttribs;
+      attribs.length = 0;
+      var start = Infinity, end = 0, total = 0;
+      for (var i = 0; i < GL.currentContext.maxVertexAttribs; ++i) {
+        var cb = GL.currentContext.clientBuffers[i];
+        if (!cb.clientside || !cb.enabled) continue;
+        cb.uploadSize = GL.calcBufLength(cb.size, cb.type, cb.stride, count);
+        start = Math.min(start, cb.ptr);
+        end = Math.max(end, cb.ptr + cb.uploadSize);
+        total += cb.uploadSize;
+        attribs.push(i);
+      }
+      if (!attribs.length) return;
+      GL.resetBufferBinding = true;
+
+      // Data is always placed at the same address modulo 8 as it has in the
+      // heap, so that attribute offsets stay aligned to their type size.
+      start &= ~7;
+      var data;
+      if (end - start <= 2 * total + 256) {
+        // Interleaved or adjacent arrays: upload the whole range directly from
+        // the heap.
+        var offset = GL.allocClientArrayRingSpace(end - start);
+        for (var i of attribs) {
+          var cb = GL.currentContext.clientBuffers[i];
+          cb.uploadOffset = offset + cb.ptr - start;
+        }
+        data = HEAPU8.subarray(start, end);
+      } else {
+        // Scattered arrays: pack them together so that they can still be
+        // uploaded with a single call.
+        var packedSize = 0;
+        for (var i of attribs) {
+          var cb = GL.currentContext.clientBuffers[i];
+          packedSize += cb.uploadSize + 8;
+        }
+        if (!GL.clientArrayStaging || GL.clientArrayStaging.length < packedSize) {
+          GL.clientArrayStaging = new Uint8Array(1 << GL.log2ceilLookup(packedSize));
+        }
+        var offset = GL.allocClientArrayRingSpace(packedSize);
+        var pos = 0;
+        for (var i of attribs) {
+          var cb = GL.currentContext.clientBuffers[i];
+          pos += cb.ptr & 7;
+          GL.clientArrayStaging.set(HEAPU8.subarray(cb.ptr, cb.ptr + cb.uploadSize), pos);
+          cb.uploadOffset = offset + pos;
+          pos = (pos + cb.uploadSize + 7) & ~7;
+        }
+        data = GL.clientArrayStaging.subarray(0, pos);
+        // Give back the unused part of the worst case reservation.
+        GL.currentContext.clientArrayRingHead = offset + pos;
+      }
+
+      GLctx.bindBuffer(0x8892 /*GL_ARRAY_BUFFER*/, GL.currentContext.clientArrayRingBuffer);
+      GLctx.bufferSubData(0x8892 /*GL_ARRAY_BUFFER*/, offset, data);
+      for (var i of attribs) {
+        var cb = GL.currentContext.clientBuffers[i];
+#if GL_ASSERTIONS
+        GL.validateVertexAttribPointer(cb.size, cb.type, cb.stride, cb.uploadOffset);
+#endif
+        cb.vertexAttribPointerAdaptor.call(GLctx, i, cb.size, cb.type, cb.normalized, cb.stride, cb.uploadOffset);
+      }
+    },
+#else
     preDrawHandleClientVertexAttribBindings: (count) => {
       GL.resetBufferBinding = false;
 
@@ -545,6 +649,8 @@ for (/**@suppress{duplicate}*/var i = 0; i <= {{{ GL_POOL_TEMP_BUFFERS_SIZE }}};
       }
     },
 
+#endif // GL_CLIENT_ARRAY_RING_BUFFER_SIZE
+
     postDrawHandleClientVertexAttribBindings: () => {
       if (GL.resetBufferBinding) {
         GLctx.bindBuffer(0x8892 /*GL_ARRAY_BUFFER*/, GL.buffers[GLctx.currentArrayBufferBinding]);
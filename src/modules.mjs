@@ -87,6 +87,10 @@ export const LibraryManager = {
       libraries.push('library_autodebug.js');
     }
 
+    if (SAMPLING_PROFILER) {
+      libraries.push('library_sampling_profiler.js');
+    }
+
     if (!WASMFS) {
       libraries.push('library_syscall.js');
     }
@@ -418,7 +422,7 @@ function exportRuntime() {
     'HEAPU64',
   ];
 
-  if (PTHREADS && ALLOW_MEMORY_GROWTH) {
+  if (PTHREADS && ALLOW_MEMORY_GROWTH && !GROWABLE_ARRAYBUFFERS) {
     runtimeElements.push(
       'GROWABLE_HEAP_I8',
       'GROWABLE_HEAP_U8',
@@ -212,6 +212,15 @@ function run() {
 
     initRuntime();
 
+#if MEMORY_SNAPSHOT
+    if (Module['takeSnapshot']) {
+      // Stop before main() and hand the initialized state to the caller
+      // (see tools/take_snapshot.mjs).
+      Module['takeSnapshot'](takeSnapshot());
+      return;
+    }
+#endif
+
 #if HAS_MAIN
     preMain();
 #endif
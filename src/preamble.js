@@ -673,11 +673,74 @@ var wasmOffsetConverter;
 
 #if SPLIT_MODULE
 {{{ makeModuleReceiveWithVar('loadSplitModule', undefined, 'instantiateSync',  true) }}}
+#if SPLIT_MODULE_CHUNKS
+// The table slots that each secondary module (chunk) fills in, as a list of
+// [start, end) ranges per chunk.  The first element is the number of chunks
+// that are prefetched: these hold the code that the profiles saw being used
+// after startup, in the order it was first used.
+var splitChunks = JSON.parse('<<< SPLIT_MODULE_CHUNKS >>>');
+var splitChunkPrefetchCount = splitChunks.shift();
+// Chunks that have been fetched and compiled ahead of their first call, and
+// chunks that have been instantiated.
+var splitChunkModules = [];
+var splitChunkLoaded = [];
+
+var splitChunkFile = (chunk) => wasmBinaryFile.slice(0, -5) + `.chunk${chunk}.wasm`;
+
+var splitChunkForSlot = (slot) => splitChunks.findIndex((ranges) => {
+  for (var i = 0; i < ranges.length; i += 2) {
+    if (slot >= ranges[i] && slot < ranges[i + 1]) return true;
+  }
+  return false;
+});
+
+var loadSplitChunk = (chunk, prop) => {
+  var imports = {'primary': wasmExports};
+  if (splitChunkModules[chunk]) {
+    new WebAssembly.Instance(splitChunkModules[chunk], imports);
+    splitChunkModules[chunk] = null;
+  } else {
+    if (!readBinary && loadSplitModule == instantiateSync) {
+      // This would fail in getBinarySync with a less helpful message.
+      abort(`${splitChunkFile(chunk)} is needed for table slot ${prop} before it finished loading.  On the main thread of a web page secondary modules can only be loaded asynchronously, starting when the primary module is instantiated.  Provide Module.loadSplitModule to load them in another way`);
+    }
+    loadSplitModule(splitChunkFile(chunk), imports, prop);
+  }
+  splitChunkLoaded[chunk] = true;
+};
+
+// Fetch and compile chunks in the background as soon as the primary module is
+// instantiated, so that their first call does not have to wait for them.
+// Where chunks cannot be fetched synchronously (on the main thread of a web
+// page) all of them are prefetched, otherwise only the ones that the profiles
+// expect to be used.
+var prefetchSplitChunks = (chunk) => {
+  var count = readBinary ? splitChunkPrefetchCount : splitChunks.length;
+  if (chunk >= count) return;
+  if (splitChunkLoaded[chunk] || splitChunkModules[chunk]) {
+    prefetchSplitChunks(chunk + 1);
+    return;
+  }
+  readAsync(splitChunkFile(chunk))
+    .then((binary) => WebAssembly.compile(binary))
+    .then((module) => {
+      if (!splitChunkLoaded[chunk]) splitChunkModules[chunk] = module;
+    }, (e) => err(`failed to prefetch ${splitChunkFile(chunk)}: ${e}`))
+    .then(() => prefetchSplitChunks(chunk + 1));
+};
+#endif
 var splitModuleProxyHandler = {
   get(target, prop, receiver) {
     return (...args) => {
 #if ASYNCIFY == 2
       throw new Error('Placeholder function "' + prop + '" should not be called when using JSPI.');
+#elif SPLIT_MODULE_CHUNKS
+      var chunk = splitChunkForSlot(+prop);
+      if (chunk < 0 || splitChunkLoaded[chunk]) {
+        abort(`no secondary module fills in table slot ${prop}`);
+      }
+      loadSplitChunk(chunk, prop);
+      return wasmTable.get(prop)(...args);
 #else
       err(`placeholder function called: ${prop}`);
       var imports = {'primary': wasmExports};
@@ -992,7 +1055,13 @@ function createWasm() {
 #endif
 #endif
 
-#if hasExportedSymbol('__wasm_call_ctors')
+#if SPLIT_MODULE_CHUNKS
+    prefetchSplitChunks(0);
+#endif
+
+#if MEMORY_SNAPSHOT
+    addOnInit(initFromSnapshot);
+#elif hasExportedSymbol('__wasm_call_ctors')
     addOnInit(wasmExports['__wasm_call_ctors']);
 #endif
 
@@ -229,6 +229,11 @@ if (ENVIRONMENT_IS_PTHREAD) {
         if (initializedJS) {
           checkMailbox();
         }
+#if MAIN_MODULE
+      } else if (cmd === 'sharedModule') {
+        // A side module that was compiled on another thread.
+        sharedModules[msgData['name']] = msgData['module'];
+#endif
       } else if (cmd) {
         // The received message looks like something that should be handled by this message
         // handler, (since there is a cmd field present), but is not one of the
@@ -29,7 +29,16 @@
 }}}
 
 function updateMemoryViews() {
+#if GROWABLE_ARRAYBUFFERS
+  // Views on a resizable buffer track its length, so there is no need to
+  // recreate them when the memory grows.
+#if ASSERTIONS
+  assert(wasmMemory.toResizableBuffer, 'GROWABLE_ARRAYBUFFERS requires support for WebAssembly.Memory.prototype.toResizableBuffer');
+#endif
+  var b = wasmMemory.toResizableBuffer();
+#else
   var b = wasmMemory.buffer;
+#endif
 #if SUPPORT_BIG_ENDIAN
   {{{ maybeExportHeap('HEAP_DATA_VIEW') }}} HEAP_DATA_VIEW = new DataView(b);
 #endif
@@ -242,6 +242,38 @@ var MEMORY_GROWTH_GEOMETRIC_CAP = 96*1024*1024;
 // [link]
 var MEMORY_GROWTH_LINEAR_STEP = -1;
 
+// Create the JS heap views (HEAP8 etc.) over a resizable ArrayBuffer, obtained
+// with ``WebAssembly.Memory.prototype.toResizableBuffer()``, so that they track
+// the size of the memory and stay valid when it grows.  With pthreads and
+// ALLOW_MEMORY_GROWTH this removes the check that is otherwise needed on every
+// heap access in JS (see ``src/growableHeap.js``), since another thread may have
+// grown the memory.
+// Requires -pthread and ALLOW_MEMORY_GROWTH, since Web APIs reject views on a
+// resizable buffer and the JS library only copies heap data out of shared
+// memory before passing it to them.  WebGL and WebGPU are not supported.
+// This requires engine support that is not yet widely available (Chrome 136,
+// Node 24), and the MIN_*_VERSION settings are raised accordingly.
+// [link]
+// [experimental]
+var GROWABLE_ARRAYBUFFERS = false;
+
+// Take a snapshot of the program's state at link time, and start from it at
+// runtime.  The linker runs the program under node up to the point where
+// main() would be called, and saves its linear memory and the contents of the
+// in-memory filesystem (including any preloaded files) to
+// ``<name>.snapshot``.  At startup that file is loaded instead of the
+// preloaded files, and restored instead of running the static constructors.
+// Only state in the wasm memory and MEMFS is captured: static constructors
+// must not set up state in JS (for example through EM_ASM, or with embind),
+// or add functions to the table.  The environment (``environ``) is read again
+// at startup, but values that static constructors copied out of it (e.g. with
+// ``getenv``) are the ones from the node process that took the snapshot.
+// This is not compatible with pthreads, dynamic linking, MINIMAL_RUNTIME or
+// SINGLE_FILE, and ENVIRONMENT must include node.
+// [link]
+// [experimental]
+var MEMORY_SNAPSHOT = false;
+
 // The "architecture" to compile for. 0 means the default wasm32, 1 is
 // the full end-to-end wasm64 mode, and 2 is wasm64 for clang/lld but lowered to
 // wasm32 in Binaryen (such that it can run on wasm32 engines, while internally
@@ -449,6 +481,16 @@ var GL_TESTING = false;
 // [link]
 var GL_MAX_TEMP_BUFFER_SIZE = 2097152;
 
+// When non-zero, FULL_ES2 uploads client-side vertex arrays into a single
+// streaming ring buffer of this many bytes (per context), instead of into a
+// set of temporary buffers.  All client-side attributes of a draw call are
+// uploaded with one ``bufferSubData`` call, and successive draws append to the
+// same buffer.  The buffer should be large enough to hold the client-side
+// vertex data of a couple of frames, as wrapping around may force the GPU to
+// synchronize.  Draws that need more space than this grow the buffer.
+// [link]
+var GL_CLIENT_ARRAY_RING_BUFFER_SIZE = 0;
+
 // Enables some potentially-unsafe optimizations in GL emulation code
 // [link]
 var GL_UNSAFE_OPTS = true;
@@ -913,6 +955,17 @@ var ASYNCIFY_ONLY = [];
 // [link]
 var ASYNCIFY_ADVISE = false;
 
+// Records which call stacks actually unwind at runtime, and how much state
+// each of them saves.  When the runtime exits (and at any time by calling
+// ``Module.asyncifyProfileReport()``) a report is printed that contains the
+// minimal set of functions that needs to be instrumented, in the format of an
+// ``ASYNCIFY_ONLY`` response file, along with a suggested
+// ``ASYNCIFY_STACK_SIZE``.  Build with the same optimization level as the
+// final build, and make sure to exercise all the code paths that can sleep,
+// as functions that were never seen unwinding will not be in the list.
+// [link]
+var ASYNCIFY_PROFILE = false;
+
 // Allows lazy code loading: where emscripten_lazy_load_code() is written, we
 // will pause execution, load the rest of the code, and then resume.
 // [link]
@@ -1044,6 +1097,17 @@ var FORCE_FILESYSTEM = false;
 // [link]
 var NODERAWFS = false;
 
+// When non-zero, MEMFS stores file data as a list of fixed size pages of this
+// many bytes instead of in a single contiguous typed array.  This makes
+// appending to large files linear in the number of bytes written (the existing
+// data is never copied when a file grows), and avoids the temporary doubling of
+// memory usage that reallocation causes.  The contiguous form of a file is
+// materialized lazily, and only when something asks for it (for example
+// IDBFS), while ``read()`` and ``mmap()`` copy straight from the pages.  A
+// value of 0 (the default) uses the contiguous layout.
+// [link]
+var MEMFS_PAGE_SIZE = 0;
+
 // This saves the compiled wasm module in a file with name
 // ``$WASM_BINARY_NAME.$V8_VERSION.cached``
 // and loads it on subsequent runs. This caches the compiled wasm code from
@@ -1389,6 +1453,23 @@ var BOOTSTRAPPING_STRUCT_INFO = false;
 // [compile+link]
 var EMSCRIPTEN_TRACING = false;
 
+// Profile the program with the CPU sampling profiler of the JS engine while it
+// runs, without needing devtools attached. The samples are aggregated in
+// memory as folded stacks (the input format of flamegraph.pl, speedscope and
+// similar tools), and written to ``Module['samplingProfilerFile']`` (by
+// default ``profile.folded``) when the process exits or receives SIGUSR2.
+// Wasm functions appear under their names if the wasm has a name section (e.g.
+// with ``--profiling-funcs``), and as ``wasm-function[N]`` otherwise;
+// ``emsymbolizer --folded`` replaces the latter with the function names from a
+// symbol map (see ``--emit-symbol-map``). Only the main thread is profiled,
+// and only under Node.js.
+// [link]
+var SAMPLING_PROFILER = false;
+
+// The interval between samples taken by SAMPLING_PROFILER, in microseconds.
+// [link]
+var SAMPLING_PROFILER_INTERVAL = 1000;
+
 // Specify the GLFW version that is being linked against.  Only relevant, if you
 // are linking against the GLFW library.  Valid options are 2 for GLFW2 and 3
 // for GLFW3.
@@ -1708,6 +1789,19 @@ var PTHREAD_POOL_SIZE_STRICT = 1;
 // [link] - affects generated JS runtime code at link time
 var PTHREAD_POOL_DELAY_LOAD = false;
 
+// Keep a pool of at least this many fully-loaded idle Workers available at all
+// times.  Unlike PTHREAD_POOL_SIZE, startup does not wait for these Workers;
+// they are created in the background once the wasm module is ready, and the
+// pool is topped up again (off the pthread_create path) each time a Worker is
+// handed out to a new thread.  The size of the most recent burst of
+// pthread_create calls is used to predict the next one, so the pool may
+// temporarily grow up to twice this value.  Workers whose thread has exited
+// are always returned to the pool rather than being terminated.
+// Can be combined with PTHREAD_POOL_SIZE, in which case PTHREAD_POOL_SIZE
+// Workers are still loaded before main() runs.
+// [link]
+var PTHREAD_POOL_WARM = 0;
+
 // Default stack size to use for newly created pthreads.  When not set, this
 // defaults to STACK_SIZE (which in turn defaults to 64k).  Can also be set at
 // runtime using pthread_attr_setstacksize().  Note that the wasm control flow
@@ -1771,11 +1865,14 @@ var PTHREADS_DEBUG = false;
 // [link]
 var EVAL_CTORS = 0;
 
-// Is enabled, use the JavaScript TextDecoder API for string marshalling.
+// Is enabled, use the JavaScript TextDecoder API for string marshalling.  With
+// -msimd128, TextEncoder.encodeInto is also used for writing long strings to
+// memory (except with shared memory).
 // Enabled by default, set this to 0 to disable.
-// If set to 2, we assume TextDecoder is present and usable, and do not emit
-// any JS code to fall back if it is missing. In single threaded -Oz build modes,
-// TEXTDECODER defaults to value == 2 to save code size.
+// If set to 2, we assume TextDecoder and TextEncoder are present and usable,
+// and do not emit any JS code to fall back if they are missing. In single
+// threaded -Oz build modes, TEXTDECODER defaults to value == 2 to save code
+// size.
 // [link]
 var TEXTDECODER = 1;
 
@@ -1842,6 +1939,13 @@ var FETCH = false;
 // [experimental]
 var WASMFS = false;
 
+// The maximum number of worker threads that WasmFS backends which run
+// asynchronous JS off the main thread (such as the OPFS and fetch backends)
+// use.  The threads are shared between all such backends and started on demand,
+// and different files can be serviced by different threads concurrently.
+// [link]
+var WASMFS_IO_THREADS = 4;
+
 // If set to 1, embeds all subresources in the emitted file as base64 string
 // literals. Embedded subresources may include (but aren't limited to) wasm,
 // asm.js, and static memory initialization code.
@@ -2110,6 +2214,32 @@ var IMPORTED_MEMORY = false;
 // [link]
 var SPLIT_MODULE = false;
 
+// Profiles written by a ``-sSPLIT_MODULE`` build of the same program.  When
+// set (together with SPLIT_MODULE), the wasm is split at link time into a
+// primary module and many small secondary modules (chunks), named
+// ``<name>.chunk<N>.wasm``, which are loaded the first time one of their
+// functions is called.
+// The functions that the first profile saw being called stay in the primary
+// module.  The functions first called in any later profile are grouped into
+// chunks in the order they were first called, and those chunks are
+// prefetched in the background, starting as soon as the primary module is
+// instantiated.  The remaining functions are grouped into chunks in the order
+// they appear in the module.  On the main thread of a web page, where chunks
+// cannot be fetched synchronously, all the chunks are prefetched, and calling
+// a function whose chunk has not finished loading aborts (unless
+// Module.loadSplitModule can load it).
+// The profiles must be taken from a build with the same inputs and flags;
+// wasm-split checks this.
+// [link]
+// [experimental]
+var SPLIT_MODULE_PROFILES = [];
+
+// The maximum size of the code in each chunk created with
+// SPLIT_MODULE_PROFILES, in bytes.  A single function larger than this is
+// placed in a chunk of its own.
+// [link]
+var SPLIT_MODULE_CHUNK_SIZE = 64*1024;
+
 // For MAIN_MODULE builds, automatically load any dynamic library dependencies
 // on startup, before loading the main module.
 var AUTOLOAD_DYLIBS = true;
@@ -134,6 +134,13 @@ var WASM_BINARY_FILE = '';
 // name of the file containing the Wasm Worker *.ww.js, if relevant
 var WASM_WORKER_FILE = '';
 
+// name of the file containing the memory snapshot, if MEMORY_SNAPSHOT is set
+var MEMORY_SNAPSHOT_FILE = '';
+
+// Whether the wasm is split into many secondary modules, based on
+// SPLIT_MODULE_PROFILES.
+var SPLIT_MODULE_CHUNKS = false;
+
 // name of the file containing the Audio Worklet *.aw.js, if relevant
 var AUDIO_WORKLET_FILE = '';
 
@@ -254,6 +261,13 @@ var PTHREADS = false;
 
 var BULK_MEMORY = false;
 
+// Set when -msimd128 (or -mrelaxed-simd) is passed
+var WASM_SIMD = false;
+
+// Set when libsimdstring is linked in, which the JS string conversion
+// functions then use for long strings.
+var SIMD_STRINGS = false;
+
 var MINIFY_WHITESPACE = true;
 
 var ASYNCIFY_IMPORTS_EXCEPT_JS_LIBS = [];
@@ -22,6 +22,10 @@ var emscriptenThreadProfiler = {
       document.body.appendChild(div);
       this.threadProfilerDiv = document.getElementById('threadprofiler');
     }
+    var button = document.createElement('button');
+    button.textContent = 'Download timeline';
+    button.onclick = () => emscriptenThreadProfiler.downloadTrace();
+    this.threadProfilerDiv.parentNode.insertBefore(button, this.threadProfilerDiv.nextSibling);
     var i = setInterval(function() { emscriptenThreadProfiler.updateUi() }, this.uiUpdateIntervalMsecs);
     addOnExit(() => clearInterval(i));
   },
@@ -30,17 +34,78 @@ var emscriptenThreadProfiler = {
     addOnInit(() => {
       emscriptenThreadProfiler.dumpState();
       var i = setInterval(function() { emscriptenThreadProfiler.dumpState() }, this.uiUpdateIntervalMsecs);
-      addOnExit(() => clearInterval(i));
+      addOnExit(() => {
+        clearInterval(i);
+        if (Module['threadProfilerTraceFile']) {
+          emscriptenThreadProfiler.saveTrace(Module['threadProfilerTraceFile']);
+        }
+      });
     });
   },
 
-  dumpState() {
-    var mainThread = _emscripten_main_runtime_thread_id();
-
-    var threads = [mainThread];
+  getThreads() {
+    var threads = [_emscripten_main_runtime_thread_id()];
     for (var i in PThread.pthreads) {
       threads.push(PThread.pthreads[i].pthread_ptr);
     }
+    return threads;
+  },
+
+  // Collects the recent status transitions of all running threads, so that
+  // the ring buffers they are recorded in do not overflow.
+  harvest() {
+    for (var threadPtr of this.getThreads()) {
+      PThread.harvestProfilerEvents(threadPtr);
+    }
+  },
+
+  // Returns the timeline of all threads, including ones that have already
+  // exited, in the Chrome trace event format.  This can be loaded in
+  // chrome://tracing or https://ui.perfetto.dev.
+  exportTrace() {
+    this.harvest();
+    var now = _emscripten_get_now();
+    var traceEvents = [];
+    var timelines = PThread.finishedProfilerTimelines.concat(Object.values(PThread.profilerTimelines));
+    for (var timeline of timelines) {
+      var tid = timeline.tid;
+      var finished = PThread.finishedProfilerTimelines.includes(timeline);
+      traceEvents.push({ name: 'thread_name', ph: 'M', pid: 1, tid, args: { name: timeline.name || ptrToString(tid) } });
+      for (var gap of timeline.gaps) {
+        traceEvents.push({ name: `${gap.lost} events lost`, ph: 'i', s: 't', pid: 1, tid, ts: gap.time * 1000 });
+      }
+      var events = timeline.events;
+      for (var i = 0; i < events.length; ++i) {
+        var end = (i + 1 < events.length) ? events[i + 1].time : (finished ? timeline.end : now);
+        traceEvents.push({
+          name: PThread.threadStatusToString(events[i].status),
+          cat: 'thread',
+          ph: 'X',
+          pid: 1,
+          tid,
+          ts: events[i].time * 1000,
+          dur: (end - events[i].time) * 1000,
+        });
+      }
+    }
+    return JSON.stringify({ traceEvents, displayTimeUnit: 'ms' });
+  },
+
+  saveTrace(filename) {
+    require('fs').writeFileSync(filename, this.exportTrace());
+  },
+
+  downloadTrace() {
+    var link = document.createElement('a');
+    link.href = URL.createObjectURL(new Blob([this.exportTrace()], { type: 'application/json' }));
+    link.download = 'threadprofile.json';
+    link.click();
+    URL.revokeObjectURL(link.href);
+  },
+
+  dumpState() {
+    this.harvest();
+    var threads = this.getThreads();
     for (var i = 0; i < threads.length; ++i) {
       var threadPtr = threads[i];
       var threadName = PThread.getThreadName(threadPtr);
@@ -60,13 +125,9 @@ var emscriptenThreadProfiler = {
       // initialized yet, ignore updating.
       return;
     }
+    this.harvest();
     var str = '';
-    var mainThread = _emscripten_main_runtime_thread_id();
-
-    var threads = [mainThread];
-    for (var i in PThread.pthreads) {
-      threads.push(PThread.pthreads[i].pthread_ptr);
-    }
+    var threads = this.getThreads();
 
     for (var i = 0; i < threads.length; ++i) {
       var threadPtr = threads[i];
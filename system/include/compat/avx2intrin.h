@@ -0,0 +1,1668 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+#ifndef __emscripten_avx2intrin_h__
+#define __emscripten_avx2intrin_h__
+
+#ifndef __AVX2__
+#error "AVX2 instruction set not enabled"
+#endif
+
+#include <avxintrin.h>
+
+// Like the 256-bit AVX operations in avxintrin.h, most of these apply the
+// corresponding SSE operation to each 128-bit half.  This matches AVX2, whose
+// integer operations mostly work within 128-bit lanes anyway.  The few that
+// cross lanes (permutes, broadcasts, gathers and widening conversions) are
+// implemented separately.
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_abs_epi8(__m256i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_abs_epi8(__a.v0);
+  __ret.v1 = _mm_abs_epi8(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_abs_epi16(__m256i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_abs_epi16(__a.v0);
+  __ret.v1 = _mm_abs_epi16(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_abs_epi32(__m256i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_abs_epi32(__a.v0);
+  __ret.v1 = _mm_abs_epi32(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_add_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_add_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_add_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_add_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_add_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_add_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_add_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_add_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_add_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_add_epi64(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_add_epi64(__a.v0, __b.v0);
+  __ret.v1 = _mm_add_epi64(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sub_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sub_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_sub_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sub_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sub_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_sub_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sub_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sub_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_sub_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sub_epi64(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sub_epi64(__a.v0, __b.v0);
+  __ret.v1 = _mm_sub_epi64(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_adds_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_adds_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_adds_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_adds_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_adds_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_adds_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_adds_epu8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_adds_epu8(__a.v0, __b.v0);
+  __ret.v1 = _mm_adds_epu8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_adds_epu16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_adds_epu16(__a.v0, __b.v0);
+  __ret.v1 = _mm_adds_epu16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_subs_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_subs_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_subs_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_subs_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_subs_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_subs_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_subs_epu8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_subs_epu8(__a.v0, __b.v0);
+  __ret.v1 = _mm_subs_epu8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_subs_epu16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_subs_epu16(__a.v0, __b.v0);
+  __ret.v1 = _mm_subs_epu16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_and_si256(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_and_si128(__a.v0, __b.v0);
+  __ret.v1 = _mm_and_si128(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_andnot_si256(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_andnot_si128(__a.v0, __b.v0);
+  __ret.v1 = _mm_andnot_si128(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_or_si256(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_or_si128(__a.v0, __b.v0);
+  __ret.v1 = _mm_or_si128(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_xor_si256(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_xor_si128(__a.v0, __b.v0);
+  __ret.v1 = _mm_xor_si128(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_avg_epu8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_avg_epu8(__a.v0, __b.v0);
+  __ret.v1 = _mm_avg_epu8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_avg_epu16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_avg_epu16(__a.v0, __b.v0);
+  __ret.v1 = _mm_avg_epu16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cmpeq_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cmpeq_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_cmpeq_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cmpeq_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cmpeq_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_cmpeq_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cmpeq_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cmpeq_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_cmpeq_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cmpeq_epi64(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cmpeq_epi64(__a.v0, __b.v0);
+  __ret.v1 = _mm_cmpeq_epi64(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cmpgt_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cmpgt_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_cmpgt_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cmpgt_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cmpgt_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_cmpgt_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cmpgt_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cmpgt_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_cmpgt_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cmpgt_epi64(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cmpgt_epi64(__a.v0, __b.v0);
+  __ret.v1 = _mm_cmpgt_epi64(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_hadd_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_hadd_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_hadd_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_hadd_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_hadd_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_hadd_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_hsub_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_hsub_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_hsub_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_hsub_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_hsub_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_hsub_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_hadds_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_hadds_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_hadds_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_hsubs_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_hsubs_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_hsubs_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_madd_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_madd_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_madd_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_maddubs_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_maddubs_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_maddubs_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_max_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_max_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_max_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_max_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_max_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_max_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_max_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_max_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_max_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_max_epu8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_max_epu8(__a.v0, __b.v0);
+  __ret.v1 = _mm_max_epu8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_max_epu16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_max_epu16(__a.v0, __b.v0);
+  __ret.v1 = _mm_max_epu16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_max_epu32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_max_epu32(__a.v0, __b.v0);
+  __ret.v1 = _mm_max_epu32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_min_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_min_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_min_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_min_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_min_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_min_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_min_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_min_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_min_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_min_epu8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_min_epu8(__a.v0, __b.v0);
+  __ret.v1 = _mm_min_epu8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_min_epu16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_min_epu16(__a.v0, __b.v0);
+  __ret.v1 = _mm_min_epu16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_min_epu32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_min_epu32(__a.v0, __b.v0);
+  __ret.v1 = _mm_min_epu32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_mul_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_mul_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_mul_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_mul_epu32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_mul_epu32(__a.v0, __b.v0);
+  __ret.v1 = _mm_mul_epu32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_mulhi_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_mulhi_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_mulhi_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_mulhi_epu16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_mulhi_epu16(__a.v0, __b.v0);
+  __ret.v1 = _mm_mulhi_epu16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_mulhrs_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_mulhrs_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_mulhrs_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_mullo_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_mullo_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_mullo_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_mullo_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_mullo_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_mullo_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_packs_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_packs_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_packs_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_packs_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_packs_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_packs_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_packus_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_packus_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_packus_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_packus_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_packus_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_packus_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sad_epu8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sad_epu8(__a.v0, __b.v0);
+  __ret.v1 = _mm_sad_epu8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_shuffle_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_shuffle_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_shuffle_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sign_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sign_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_sign_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sign_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sign_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_sign_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sign_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sign_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_sign_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_unpackhi_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_unpackhi_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpackhi_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_unpackhi_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_unpackhi_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpackhi_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_unpackhi_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_unpackhi_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpackhi_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_unpackhi_epi64(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_unpackhi_epi64(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpackhi_epi64(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_unpacklo_epi8(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_unpacklo_epi8(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpacklo_epi8(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_unpacklo_epi16(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_unpacklo_epi16(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpacklo_epi16(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_unpacklo_epi32(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_unpacklo_epi32(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpacklo_epi32(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_unpacklo_epi64(__m256i __a, __m256i __b)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_unpacklo_epi64(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpacklo_epi64(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sll_epi16(__m256i __a, __m128i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sll_epi16(__a.v0, __count);
+  __ret.v1 = _mm_sll_epi16(__a.v1, __count);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_slli_epi16(__m256i __a, int __imm)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_slli_epi16(__a.v0, __imm);
+  __ret.v1 = _mm_slli_epi16(__a.v1, __imm);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sll_epi32(__m256i __a, __m128i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sll_epi32(__a.v0, __count);
+  __ret.v1 = _mm_sll_epi32(__a.v1, __count);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_slli_epi32(__m256i __a, int __imm)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_slli_epi32(__a.v0, __imm);
+  __ret.v1 = _mm_slli_epi32(__a.v1, __imm);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sll_epi64(__m256i __a, __m128i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sll_epi64(__a.v0, __count);
+  __ret.v1 = _mm_sll_epi64(__a.v1, __count);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_slli_epi64(__m256i __a, int __imm)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_slli_epi64(__a.v0, __imm);
+  __ret.v1 = _mm_slli_epi64(__a.v1, __imm);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srl_epi16(__m256i __a, __m128i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srl_epi16(__a.v0, __count);
+  __ret.v1 = _mm_srl_epi16(__a.v1, __count);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srli_epi16(__m256i __a, int __imm)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srli_epi16(__a.v0, __imm);
+  __ret.v1 = _mm_srli_epi16(__a.v1, __imm);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srl_epi32(__m256i __a, __m128i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srl_epi32(__a.v0, __count);
+  __ret.v1 = _mm_srl_epi32(__a.v1, __count);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srli_epi32(__m256i __a, int __imm)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srli_epi32(__a.v0, __imm);
+  __ret.v1 = _mm_srli_epi32(__a.v1, __imm);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srl_epi64(__m256i __a, __m128i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srl_epi64(__a.v0, __count);
+  __ret.v1 = _mm_srl_epi64(__a.v1, __count);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srli_epi64(__m256i __a, int __imm)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srli_epi64(__a.v0, __imm);
+  __ret.v1 = _mm_srli_epi64(__a.v1, __imm);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sra_epi16(__m256i __a, __m128i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sra_epi16(__a.v0, __count);
+  __ret.v1 = _mm_sra_epi16(__a.v1, __count);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srai_epi16(__m256i __a, int __imm)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srai_epi16(__a.v0, __imm);
+  __ret.v1 = _mm_srai_epi16(__a.v1, __imm);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sra_epi32(__m256i __a, __m128i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sra_epi32(__a.v0, __count);
+  __ret.v1 = _mm_sra_epi32(__a.v1, __count);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srai_epi32(__m256i __a, int __imm)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srai_epi32(__a.v0, __imm);
+  __ret.v1 = _mm_srai_epi32(__a.v1, __imm);
+  return __ret;
+}
+
+#define _mm256_alignr_epi8(__a, __b, __imm) __extension__ ({ \
+  __m256i __x = (__a), __y = (__b), __ret; \
+  __ret.v0 = _mm_alignr_epi8(__x.v0, __y.v0, (__imm)); \
+  __ret.v1 = _mm_alignr_epi8(__x.v1, __y.v1, (__imm)); \
+  __ret; })
+
+#define _mm256_blend_epi16(__a, __b, __imm) __extension__ ({ \
+  __m256i __x = (__a), __y = (__b), __ret; \
+  __ret.v0 = _mm_blend_epi16(__x.v0, __y.v0, (__imm)); \
+  __ret.v1 = _mm_blend_epi16(__x.v1, __y.v1, (__imm)); \
+  __ret; })
+
+#define _mm_blend_epi32(__a, __b, __imm) \
+  ((__m128i)_mm_blend_ps((__m128)(__a), (__m128)(__b), (__imm)))
+
+#define _mm256_blend_epi32(__a, __b, __imm) __extension__ ({ \
+  __m256i __x = (__a), __y = (__b), __ret; \
+  __ret.v0 = _mm_blend_epi32(__x.v0, __y.v0, (__imm) & 15); \
+  __ret.v1 = _mm_blend_epi32(__x.v1, __y.v1, ((__imm) >> 4) & 15); \
+  __ret; })
+
+#define _mm256_shuffle_epi32(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a), __ret; \
+  __ret.v0 = _mm_shuffle_epi32(__x.v0, (__imm)); \
+  __ret.v1 = _mm_shuffle_epi32(__x.v1, (__imm)); \
+  __ret; })
+
+#define _mm256_shufflehi_epi16(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a), __ret; \
+  __ret.v0 = _mm_shufflehi_epi16(__x.v0, (__imm)); \
+  __ret.v1 = _mm_shufflehi_epi16(__x.v1, (__imm)); \
+  __ret; })
+
+#define _mm256_shufflelo_epi16(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a), __ret; \
+  __ret.v0 = _mm_shufflelo_epi16(__x.v0, (__imm)); \
+  __ret.v1 = _mm_shufflelo_epi16(__x.v1, (__imm)); \
+  __ret; })
+
+#define _mm256_bslli_epi128(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a), __ret; \
+  __ret.v0 = _mm_slli_si128(__x.v0, (__imm)); \
+  __ret.v1 = _mm_slli_si128(__x.v1, (__imm)); \
+  __ret; })
+
+#define _mm256_bsrli_epi128(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a), __ret; \
+  __ret.v0 = _mm_srli_si128(__x.v0, (__imm)); \
+  __ret.v1 = _mm_srli_si128(__x.v1, (__imm)); \
+  __ret; })
+
+#define _mm256_slli_si256(__a, __imm) _mm256_bslli_epi128((__a), (__imm))
+#define _mm256_srli_si256(__a, __imm) _mm256_bsrli_epi128((__a), (__imm))
+
+#define _mm256_permute4x64_epi64(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a), __ret; \
+  __ret.v0 = (__m128i)wasm_i64x2_shuffle(__x.v0, __x.v1, (__imm) & 3, ((__imm) >> 2) & 3); \
+  __ret.v1 = (__m128i)wasm_i64x2_shuffle(__x.v0, __x.v1, ((__imm) >> 4) & 3, ((__imm) >> 6) & 3); \
+  __ret; })
+
+#define _mm256_permute4x64_pd(__a, __imm) \
+  _mm256_castsi256_pd(_mm256_permute4x64_epi64(_mm256_castpd_si256(__a), (__imm)))
+
+#define _mm256_permute2x128_si256(__a, __b, __imm) \
+  _mm256_permute2f128_si256((__a), (__b), (__imm))
+#define _mm256_extracti128_si256(__a, __imm) _mm256_extractf128_si256((__a), (__imm))
+#define _mm256_inserti128_si256(__a, __b, __imm) \
+  _mm256_insertf128_si256((__a), (__b), (__imm))
+
+// Selects dwords from the eight in `__a0` and `__a1` by the low 3 bits of each
+// lane of `__idx`.
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+__avx2_permutevar8x32_half(__m128i __a0, __m128i __a1, __m128i __idx)
+{
+  // Turn each dword index into the indices of its four bytes.
+  v128_t __bytes = wasm_i32x4_shl(wasm_v128_and(__idx, wasm_i32x4_splat(3)), 2);
+  __bytes = wasm_i32x4_add(wasm_i32x4_mul(__bytes, wasm_i32x4_splat(0x01010101)),
+                           wasm_i32x4_splat(0x03020100));
+  v128_t __hi = wasm_i32x4_ne(wasm_v128_and(__idx, wasm_i32x4_splat(4)), wasm_i32x4_splat(0));
+  return wasm_v128_bitselect(wasm_i8x16_swizzle(__a1, __bytes),
+                             wasm_i8x16_swizzle(__a0, __bytes), __hi);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_permutevar8x32_epi32(__m256i __a, __m256i __idx)
+{
+  __m256i __ret;
+  __ret.v0 = __avx2_permutevar8x32_half(__a.v0, __a.v1, __idx.v0);
+  __ret.v1 = __avx2_permutevar8x32_half(__a.v0, __a.v1, __idx.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_permutevar8x32_ps(__m256 __a, __m256i __idx)
+{
+  return _mm256_castsi256_ps(_mm256_permutevar8x32_epi32(_mm256_castps_si256(__a), __idx));
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_blendv_epi8(__m256i __a, __m256i __b, __m256i __mask)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_blendv_epi8(__a.v0, __b.v0, __mask.v0);
+  __ret.v1 = _mm_blendv_epi8(__a.v1, __b.v1, __mask.v1);
+  return __ret;
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_movemask_epi8(__m256i __a)
+{
+  return (int)((unsigned)_mm_movemask_epi8(__a.v0) | ((unsigned)_mm_movemask_epi8(__a.v1) << 16));
+}
+
+// Per-lane variable shifts.  Unlike the generic vector shift operators, these
+// shift in zeros (or sign bits for srav) when the count exceeds the lane width.
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_sllv_epi32(__m128i __a, __m128i __count)
+{
+  __u32x4 __c = (__u32x4)__count;
+  return (__m128i)(((__u32x4)__a << (__c & 31)) & (__u32x4)(__c < 32));
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_sllv_epi64(__m128i __a, __m128i __count)
+{
+  __u64x2 __c = (__u64x2)__count;
+  return (__m128i)(((__u64x2)__a << (__c & 63)) & (__u64x2)(__c < 64));
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_srlv_epi32(__m128i __a, __m128i __count)
+{
+  __u32x4 __c = (__u32x4)__count;
+  return (__m128i)(((__u32x4)__a >> (__c & 31)) & (__u32x4)(__c < 32));
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_srlv_epi64(__m128i __a, __m128i __count)
+{
+  __u64x2 __c = (__u64x2)__count;
+  return (__m128i)(((__u64x2)__a >> (__c & 63)) & (__u64x2)(__c < 64));
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_srav_epi32(__m128i __a, __m128i __count)
+{
+  __u32x4 __c = (__u32x4)__count;
+  // Counts of 32 or more behave like 31.
+  __c = (__c | (__u32x4)(__c > 31)) & 31;
+  return (__m128i)((__i32x4)__a >> (__i32x4)__c);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sllv_epi32(__m256i __a, __m256i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sllv_epi32(__a.v0, __count.v0);
+  __ret.v1 = _mm_sllv_epi32(__a.v1, __count.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_sllv_epi64(__m256i __a, __m256i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_sllv_epi64(__a.v0, __count.v0);
+  __ret.v1 = _mm_sllv_epi64(__a.v1, __count.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srlv_epi32(__m256i __a, __m256i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srlv_epi32(__a.v0, __count.v0);
+  __ret.v1 = _mm_srlv_epi32(__a.v1, __count.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srlv_epi64(__m256i __a, __m256i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srlv_epi64(__a.v0, __count.v0);
+  __ret.v1 = _mm_srlv_epi64(__a.v1, __count.v1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_srav_epi32(__m256i __a, __m256i __count)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_srav_epi32(__a.v0, __count.v0);
+  __ret.v1 = _mm_srav_epi32(__a.v1, __count.v1);
+  return __ret;
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_broadcastb_epi8(__m128i __a)
+{
+  return _mm_set1_epi8((char)_mm_cvtsi128_si32(__a));
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_broadcastw_epi16(__m128i __a)
+{
+  return _mm_set1_epi16((short)_mm_cvtsi128_si32(__a));
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_broadcastd_epi32(__m128i __a)
+{
+  return _mm_shuffle_epi32(__a, 0);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_broadcastq_epi64(__m128i __a)
+{
+  return _mm_unpacklo_epi64(__a, __a);
+}
+
+static __inline__ __m128 __attribute__((__always_inline__, __nodebug__))
+_mm_broadcastss_ps(__m128 __a)
+{
+  return _mm_shuffle_ps(__a, __a, 0);
+}
+
+static __inline__ __m128d __attribute__((__always_inline__, __nodebug__))
+_mm_broadcastsd_pd(__m128d __a)
+{
+  return _mm_movedup_pd(__a);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcastb_epi8(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v1 = __ret.v0 = _mm_broadcastb_epi8(__a);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcastw_epi16(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v1 = __ret.v0 = _mm_broadcastw_epi16(__a);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcastd_epi32(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v1 = __ret.v0 = _mm_broadcastd_epi32(__a);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcastq_epi64(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v1 = __ret.v0 = _mm_broadcastq_epi64(__a);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcastss_ps(__m128 __a)
+{
+  __m256 __ret;
+  __ret.v1 = __ret.v0 = _mm_broadcastss_ps(__a);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcastsd_pd(__m128d __a)
+{
+  __m256d __ret;
+  __ret.v1 = __ret.v0 = _mm_broadcastsd_pd(__a);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcastsi128_si256(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v1 = __ret.v0 = __a;
+  return __ret;
+}
+
+#define _mm_broadcastsi128_si256(__a) _mm256_broadcastsi128_si256(__a)
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepi8_epi16(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepi8_epi16(__a);
+  __ret.v1 = _mm_cvtepi8_epi16(_mm_srli_si128(__a, 8));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepi8_epi32(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepi8_epi32(__a);
+  __ret.v1 = _mm_cvtepi8_epi32(_mm_srli_si128(__a, 4));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepi8_epi64(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepi8_epi64(__a);
+  __ret.v1 = _mm_cvtepi8_epi64(_mm_srli_si128(__a, 2));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepi16_epi32(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepi16_epi32(__a);
+  __ret.v1 = _mm_cvtepi16_epi32(_mm_srli_si128(__a, 8));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepi16_epi64(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepi16_epi64(__a);
+  __ret.v1 = _mm_cvtepi16_epi64(_mm_srli_si128(__a, 4));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepi32_epi64(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepi32_epi64(__a);
+  __ret.v1 = _mm_cvtepi32_epi64(_mm_srli_si128(__a, 8));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepu8_epi16(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepu8_epi16(__a);
+  __ret.v1 = _mm_cvtepu8_epi16(_mm_srli_si128(__a, 8));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepu8_epi32(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepu8_epi32(__a);
+  __ret.v1 = _mm_cvtepu8_epi32(_mm_srli_si128(__a, 4));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepu8_epi64(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepu8_epi64(__a);
+  __ret.v1 = _mm_cvtepu8_epi64(_mm_srli_si128(__a, 2));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepu16_epi32(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepu16_epi32(__a);
+  __ret.v1 = _mm_cvtepu16_epi32(_mm_srli_si128(__a, 8));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepu16_epi64(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepu16_epi64(__a);
+  __ret.v1 = _mm_cvtepu16_epi64(_mm_srli_si128(__a, 4));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepu32_epi64(__m128i __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtepu32_epi64(__a);
+  __ret.v1 = _mm_cvtepu32_epi64(_mm_srli_si128(__a, 8));
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_stream_load_si256(const void *__p)
+{
+  return _mm256_load_si256((const __m256i *)__p);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_maskload_epi32(const int *__p, __m128i __mask)
+{
+  return (__m128i)_mm_maskload_ps((const float *)__p, __mask);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm_maskload_epi64(const long long *__p, __m128i __mask)
+{
+  return (__m128i)_mm_maskload_pd((const double *)__p, __mask);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_maskload_epi32(const int *__p, __m256i __mask)
+{
+  return _mm256_castps_si256(_mm256_maskload_ps((const float *)__p, __mask));
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_maskload_epi64(const long long *__p, __m256i __mask)
+{
+  return _mm256_castpd_si256(_mm256_maskload_pd((const double *)__p, __mask));
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_maskstore_epi32(int *__p, __m128i __mask, __m128i __a)
+{
+  _mm_maskstore_ps((float *)__p, __mask, (__m128)__a);
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_maskstore_epi64(long long *__p, __m128i __mask, __m128i __a)
+{
+  _mm_maskstore_pd((double *)__p, __mask, (__m128d)__a);
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_maskstore_epi32(int *__p, __m256i __mask, __m256i __a)
+{
+  _mm256_maskstore_ps((float *)__p, __mask, _mm256_castsi256_ps(__a));
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_maskstore_epi64(long long *__p, __m256i __mask, __m256i __a)
+{
+  _mm256_maskstore_pd((double *)__p, __mask, _mm256_castsi256_pd(__a));
+}
+
+// Gathers have no wasm equivalent and are done one lane at a time.
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_mask_i32gather_epi32(__m128i __src, const int *__base, __m128i __idx, __m128i __mask, const int __scale)
+{
+  int __ret[4], __m[4];
+  int __i[4];
+  _mm_storeu_si128((__m128i *)__ret, __src);
+  _mm_storeu_si128((__m128i *)__m, __mask);
+  _mm_storeu_si128((__m128i *)__i, __idx);
+  for (int __k = 0; __k < 4; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 4);
+    }
+  }
+  return _mm_loadu_si128((const __m128i *)__ret);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_i32gather_epi32(const int *__base, __m128i __idx, const int __scale)
+{
+  return _mm_mask_i32gather_epi32(_mm_setzero_si128(), __base, __idx, _mm_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m128 __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_mask_i32gather_ps(__m128 __src, const float *__base, __m128i __idx, __m128 __mask, const int __scale)
+{
+  int __ret[4], __m[4];
+  int __i[4];
+  _mm_storeu_si128((__m128i *)__ret, (__m128i)__src);
+  _mm_storeu_si128((__m128i *)__m, (__m128i)__mask);
+  _mm_storeu_si128((__m128i *)__i, __idx);
+  for (int __k = 0; __k < 4; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 4);
+    }
+  }
+  return (__m128)_mm_loadu_si128((const __m128i *)__ret);
+}
+
+static __inline__ __m128 __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_i32gather_ps(const float *__base, __m128i __idx, const int __scale)
+{
+  return _mm_mask_i32gather_ps(_mm_setzero_ps(), __base, __idx, (__m128)_mm_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_mask_i32gather_epi64(__m128i __src, const long long *__base, __m128i __idx, __m128i __mask, const int __scale)
+{
+  long long __ret[2], __m[2];
+  int __i[4];
+  _mm_storeu_si128((__m128i *)__ret, __src);
+  _mm_storeu_si128((__m128i *)__m, __mask);
+  _mm_storeu_si128((__m128i *)__i, __idx);
+  for (int __k = 0; __k < 2; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 8);
+    }
+  }
+  return _mm_loadu_si128((const __m128i *)__ret);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_i32gather_epi64(const long long *__base, __m128i __idx, const int __scale)
+{
+  return _mm_mask_i32gather_epi64(_mm_setzero_si128(), __base, __idx, _mm_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m128d __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_mask_i32gather_pd(__m128d __src, const double *__base, __m128i __idx, __m128d __mask, const int __scale)
+{
+  long long __ret[2], __m[2];
+  int __i[4];
+  _mm_storeu_si128((__m128i *)__ret, (__m128i)__src);
+  _mm_storeu_si128((__m128i *)__m, (__m128i)__mask);
+  _mm_storeu_si128((__m128i *)__i, __idx);
+  for (int __k = 0; __k < 2; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 8);
+    }
+  }
+  return (__m128d)_mm_loadu_si128((const __m128i *)__ret);
+}
+
+static __inline__ __m128d __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_i32gather_pd(const double *__base, __m128i __idx, const int __scale)
+{
+  return _mm_mask_i32gather_pd(_mm_setzero_pd(), __base, __idx, (__m128d)_mm_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_mask_i64gather_epi32(__m128i __src, const int *__base, __m128i __idx, __m128i __mask, const int __scale)
+{
+  int __ret[4], __m[4];
+  long long __i[2];
+  _mm_storeu_si128((__m128i *)__ret, _mm_setzero_si128());
+  __builtin_memcpy(__ret, &__src, 8);
+  __builtin_memcpy(__m, &__mask, 8);
+  _mm_storeu_si128((__m128i *)__i, __idx);
+  for (int __k = 0; __k < 2; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 4);
+    }
+  }
+  return _mm_loadu_si128((const __m128i *)__ret);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_i64gather_epi32(const int *__base, __m128i __idx, const int __scale)
+{
+  return _mm_mask_i64gather_epi32(_mm_setzero_si128(), __base, __idx, _mm_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m128 __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_mask_i64gather_ps(__m128 __src, const float *__base, __m128i __idx, __m128 __mask, const int __scale)
+{
+  int __ret[4], __m[4];
+  long long __i[2];
+  _mm_storeu_si128((__m128i *)__ret, (__m128i)_mm_setzero_ps());
+  __builtin_memcpy(__ret, &__src, 8);
+  __builtin_memcpy(__m, &__mask, 8);
+  _mm_storeu_si128((__m128i *)__i, __idx);
+  for (int __k = 0; __k < 2; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 4);
+    }
+  }
+  return (__m128)_mm_loadu_si128((const __m128i *)__ret);
+}
+
+static __inline__ __m128 __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_i64gather_ps(const float *__base, __m128i __idx, const int __scale)
+{
+  return _mm_mask_i64gather_ps(_mm_setzero_ps(), __base, __idx, (__m128)_mm_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_mask_i64gather_epi64(__m128i __src, const long long *__base, __m128i __idx, __m128i __mask, const int __scale)
+{
+  long long __ret[2], __m[2];
+  long long __i[2];
+  _mm_storeu_si128((__m128i *)__ret, __src);
+  _mm_storeu_si128((__m128i *)__m, __mask);
+  _mm_storeu_si128((__m128i *)__i, __idx);
+  for (int __k = 0; __k < 2; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 8);
+    }
+  }
+  return _mm_loadu_si128((const __m128i *)__ret);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_i64gather_epi64(const long long *__base, __m128i __idx, const int __scale)
+{
+  return _mm_mask_i64gather_epi64(_mm_setzero_si128(), __base, __idx, _mm_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m128d __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_mask_i64gather_pd(__m128d __src, const double *__base, __m128i __idx, __m128d __mask, const int __scale)
+{
+  long long __ret[2], __m[2];
+  long long __i[2];
+  _mm_storeu_si128((__m128i *)__ret, (__m128i)__src);
+  _mm_storeu_si128((__m128i *)__m, (__m128i)__mask);
+  _mm_storeu_si128((__m128i *)__i, __idx);
+  for (int __k = 0; __k < 2; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 8);
+    }
+  }
+  return (__m128d)_mm_loadu_si128((const __m128i *)__ret);
+}
+
+static __inline__ __m128d __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm_i64gather_pd(const double *__base, __m128i __idx, const int __scale)
+{
+  return _mm_mask_i64gather_pd(_mm_setzero_pd(), __base, __idx, (__m128d)_mm_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_mask_i32gather_epi32(__m256i __src, const int *__base, __m256i __idx, __m256i __mask, const int __scale)
+{
+  int __ret[8], __m[8];
+  int __i[8];
+  _mm256_storeu_si256((__m256i_u *)__ret, __src);
+  _mm256_storeu_si256((__m256i_u *)__m, __mask);
+  _mm256_storeu_si256((__m256i_u *)__i, __idx);
+  for (int __k = 0; __k < 8; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 4);
+    }
+  }
+  return _mm256_loadu_si256((const __m256i_u *)__ret);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_i32gather_epi32(const int *__base, __m256i __idx, const int __scale)
+{
+  return _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), __base, __idx, _mm256_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_mask_i32gather_ps(__m256 __src, const float *__base, __m256i __idx, __m256 __mask, const int __scale)
+{
+  int __ret[8], __m[8];
+  int __i[8];
+  _mm256_storeu_si256((__m256i_u *)__ret, _mm256_castps_si256(__src));
+  _mm256_storeu_si256((__m256i_u *)__m, _mm256_castps_si256(__mask));
+  _mm256_storeu_si256((__m256i_u *)__i, __idx);
+  for (int __k = 0; __k < 8; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 4);
+    }
+  }
+  return _mm256_castsi256_ps(_mm256_loadu_si256((const __m256i_u *)__ret));
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_i32gather_ps(const float *__base, __m256i __idx, const int __scale)
+{
+  return _mm256_mask_i32gather_ps(_mm256_setzero_ps(), __base, __idx, _mm256_castsi256_ps(_mm256_set1_epi32(-1)), __scale);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_mask_i32gather_epi64(__m256i __src, const long long *__base, __m128i __idx, __m256i __mask, const int __scale)
+{
+  long long __ret[4], __m[4];
+  int __i[4];
+  _mm256_storeu_si256((__m256i_u *)__ret, __src);
+  _mm256_storeu_si256((__m256i_u *)__m, __mask);
+  _mm_storeu_si128((__m128i *)__i, __idx);
+  for (int __k = 0; __k < 4; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 8);
+    }
+  }
+  return _mm256_loadu_si256((const __m256i_u *)__ret);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_i32gather_epi64(const long long *__base, __m128i __idx, const int __scale)
+{
+  return _mm256_mask_i32gather_epi64(_mm256_setzero_si256(), __base, __idx, _mm256_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_mask_i32gather_pd(__m256d __src, const double *__base, __m128i __idx, __m256d __mask, const int __scale)
+{
+  long long __ret[4], __m[4];
+  int __i[4];
+  _mm256_storeu_si256((__m256i_u *)__ret, _mm256_castpd_si256(__src));
+  _mm256_storeu_si256((__m256i_u *)__m, _mm256_castpd_si256(__mask));
+  _mm_storeu_si128((__m128i *)__i, __idx);
+  for (int __k = 0; __k < 4; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 8);
+    }
+  }
+  return _mm256_castsi256_pd(_mm256_loadu_si256((const __m256i_u *)__ret));
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_i32gather_pd(const double *__base, __m128i __idx, const int __scale)
+{
+  return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), __base, __idx, _mm256_castsi256_pd(_mm256_set1_epi32(-1)), __scale);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_mask_i64gather_epi32(__m128i __src, const int *__base, __m256i __idx, __m128i __mask, const int __scale)
+{
+  int __ret[4], __m[4];
+  long long __i[4];
+  _mm_storeu_si128((__m128i *)__ret, __src);
+  _mm_storeu_si128((__m128i *)__m, __mask);
+  _mm256_storeu_si256((__m256i_u *)__i, __idx);
+  for (int __k = 0; __k < 4; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 4);
+    }
+  }
+  return _mm_loadu_si128((const __m128i *)__ret);
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_i64gather_epi32(const int *__base, __m256i __idx, const int __scale)
+{
+  return _mm256_mask_i64gather_epi32(_mm_setzero_si128(), __base, __idx, _mm_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m128 __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_mask_i64gather_ps(__m128 __src, const float *__base, __m256i __idx, __m128 __mask, const int __scale)
+{
+  int __ret[4], __m[4];
+  long long __i[4];
+  _mm_storeu_si128((__m128i *)__ret, (__m128i)__src);
+  _mm_storeu_si128((__m128i *)__m, (__m128i)__mask);
+  _mm256_storeu_si256((__m256i_u *)__i, __idx);
+  for (int __k = 0; __k < 4; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 4);
+    }
+  }
+  return (__m128)_mm_loadu_si128((const __m128i *)__ret);
+}
+
+static __inline__ __m128 __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_i64gather_ps(const float *__base, __m256i __idx, const int __scale)
+{
+  return _mm256_mask_i64gather_ps(_mm_setzero_ps(), __base, __idx, (__m128)_mm_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_mask_i64gather_epi64(__m256i __src, const long long *__base, __m256i __idx, __m256i __mask, const int __scale)
+{
+  long long __ret[4], __m[4];
+  long long __i[4];
+  _mm256_storeu_si256((__m256i_u *)__ret, __src);
+  _mm256_storeu_si256((__m256i_u *)__m, __mask);
+  _mm256_storeu_si256((__m256i_u *)__i, __idx);
+  for (int __k = 0; __k < 4; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 8);
+    }
+  }
+  return _mm256_loadu_si256((const __m256i_u *)__ret);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_i64gather_epi64(const long long *__base, __m256i __idx, const int __scale)
+{
+  return _mm256_mask_i64gather_epi64(_mm256_setzero_si256(), __base, __idx, _mm256_set1_epi32(-1), __scale);
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_mask_i64gather_pd(__m256d __src, const double *__base, __m256i __idx, __m256d __mask, const int __scale)
+{
+  long long __ret[4], __m[4];
+  long long __i[4];
+  _mm256_storeu_si256((__m256i_u *)__ret, _mm256_castpd_si256(__src));
+  _mm256_storeu_si256((__m256i_u *)__m, _mm256_castpd_si256(__mask));
+  _mm256_storeu_si256((__m256i_u *)__i, __idx);
+  for (int __k = 0; __k < 4; ++__k) {
+    if (__m[__k] < 0) {
+      __builtin_memcpy(&__ret[__k], (const char *)__base + __i[__k] * (long long)__scale, 8);
+    }
+  }
+  return _mm256_castsi256_pd(_mm256_loadu_si256((const __m256i_u *)__ret));
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_i64gather_pd(const double *__base, __m256i __idx, const int __scale)
+{
+  return _mm256_mask_i64gather_pd(_mm256_setzero_pd(), __base, __idx, _mm256_castsi256_pd(_mm256_set1_epi32(-1)), __scale);
+}
+
+#endif /* __emscripten_avx2intrin_h__ */
@@ -255,4 +255,1303 @@ _mm_testz_ps(__m128 __a, __m128 __b)
   return wasm_i32x4_extract_lane(__m, 0);
 }
 
+// 256-bit AVX types are emulated with pairs of 128-bit vectors: v0 holds the
+// low 128 bits and v1 the high 128 bits.  Most 256-bit operations are simply
+// the corresponding 128-bit operation applied to each half.  Since the halves
+// are separate values, compilers can keep them in registers and there is no
+// overhead compared to writing two 128-bit operations by hand.
+typedef struct {
+  __m128d v0;
+  __m128d v1;
+} __m256d __attribute__((__aligned__(32)));
+
+typedef struct {
+  __m128 v0;
+  __m128 v1;
+} __m256 __attribute__((__aligned__(32)));
+
+typedef struct {
+  __m128i v0;
+  __m128i v1;
+} __m256i __attribute__((__aligned__(32)));
+
+typedef __m256d __m256d_u __attribute__((__aligned__(1)));
+typedef __m256 __m256_u __attribute__((__aligned__(1)));
+typedef __m256i __m256i_u __attribute__((__aligned__(1)));
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_add_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_add_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_add_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_sub_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_sub_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_sub_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_mul_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_mul_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_mul_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_div_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_div_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_div_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_max_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_max_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_max_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_min_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_min_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_min_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_and_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_and_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_and_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_andnot_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_andnot_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_andnot_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_or_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_or_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_or_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_xor_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_xor_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_xor_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_addsub_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_addsub_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_addsub_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_hadd_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_hadd_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_hadd_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_hsub_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_hsub_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_hsub_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_unpackhi_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_unpackhi_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpackhi_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_unpacklo_pd(__m256d __a, __m256d __b)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_unpacklo_pd(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpacklo_pd(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_sqrt_pd(__m256d __a)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_sqrt_pd(__a.v0);
+  __ret.v1 = _mm_sqrt_pd(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_ceil_pd(__m256d __a)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_ceil_pd(__a.v0);
+  __ret.v1 = _mm_ceil_pd(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_floor_pd(__m256d __a)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_floor_pd(__a.v0);
+  __ret.v1 = _mm_floor_pd(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_blendv_pd(__m256d __a, __m256d __b, __m256d __mask)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_blendv_pd(__a.v0, __b.v0, __mask.v0);
+  __ret.v1 = _mm_blendv_pd(__a.v1, __b.v1, __mask.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_add_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_add_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_add_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_sub_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_sub_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_sub_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_mul_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_mul_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_mul_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_div_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_div_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_div_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_max_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_max_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_max_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_min_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_min_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_min_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_and_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_and_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_and_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_andnot_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_andnot_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_andnot_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_or_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_or_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_or_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_xor_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_xor_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_xor_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_addsub_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_addsub_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_addsub_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_hadd_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_hadd_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_hadd_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_hsub_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_hsub_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_hsub_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_unpackhi_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_unpackhi_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpackhi_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_unpacklo_ps(__m256 __a, __m256 __b)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_unpacklo_ps(__a.v0, __b.v0);
+  __ret.v1 = _mm_unpacklo_ps(__a.v1, __b.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_sqrt_ps(__m256 __a)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_sqrt_ps(__a.v0);
+  __ret.v1 = _mm_sqrt_ps(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_rcp_ps(__m256 __a)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_rcp_ps(__a.v0);
+  __ret.v1 = _mm_rcp_ps(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_rsqrt_ps(__m256 __a)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_rsqrt_ps(__a.v0);
+  __ret.v1 = _mm_rsqrt_ps(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_ceil_ps(__m256 __a)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_ceil_ps(__a.v0);
+  __ret.v1 = _mm_ceil_ps(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_floor_ps(__m256 __a)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_floor_ps(__a.v0);
+  __ret.v1 = _mm_floor_ps(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_blendv_ps(__m256 __a, __m256 __b, __m256 __mask)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_blendv_ps(__a.v0, __b.v0, __mask.v0);
+  __ret.v1 = _mm_blendv_ps(__a.v1, __b.v1, __mask.v1);
+  return __ret;
+}
+
+#define _mm256_blend_pd(__a, __b, __imm) __extension__ ({ \
+  __m256d __x = (__a), __y = (__b), __ret; \
+  __ret.v0 = _mm_blend_pd(__x.v0, __y.v0, (__imm) & 3); \
+  __ret.v1 = _mm_blend_pd(__x.v1, __y.v1, ((__imm) >> 2) & 3); \
+  __ret; })
+
+#define _mm256_blend_ps(__a, __b, __imm) __extension__ ({ \
+  __m256 __x = (__a), __y = (__b), __ret; \
+  __ret.v0 = _mm_blend_ps(__x.v0, __y.v0, (__imm) & 15); \
+  __ret.v1 = _mm_blend_ps(__x.v1, __y.v1, ((__imm) >> 4) & 15); \
+  __ret; })
+
+#define _mm256_dp_ps(__a, __b, __imm) __extension__ ({ \
+  __m256 __x = (__a), __y = (__b), __ret; \
+  __ret.v0 = _mm_dp_ps(__x.v0, __y.v0, (__imm)); \
+  __ret.v1 = _mm_dp_ps(__x.v1, __y.v1, (__imm)); \
+  __ret; })
+
+#define _mm256_round_pd(__a, __rounding) __extension__ ({ \
+  __m256d __x = (__a), __ret; \
+  __ret.v0 = _mm_round_pd(__x.v0, (__rounding)); \
+  __ret.v1 = _mm_round_pd(__x.v1, (__rounding)); \
+  __ret; })
+
+#define _mm256_round_ps(__a, __rounding) __extension__ ({ \
+  __m256 __x = (__a), __ret; \
+  __ret.v0 = _mm_round_ps(__x.v0, (__rounding)); \
+  __ret.v1 = _mm_round_ps(__x.v1, (__rounding)); \
+  __ret; })
+
+#define _mm256_shuffle_pd(__a, __b, __imm) __extension__ ({ \
+  __m256d __x = (__a), __y = (__b), __ret; \
+  __ret.v0 = _mm_shuffle_pd(__x.v0, __y.v0, (__imm) & 3); \
+  __ret.v1 = _mm_shuffle_pd(__x.v1, __y.v1, ((__imm) >> 2) & 3); \
+  __ret; })
+
+#define _mm256_shuffle_ps(__a, __b, __imm) __extension__ ({ \
+  __m256 __x = (__a), __y = (__b), __ret; \
+  __ret.v0 = _mm_shuffle_ps(__x.v0, __y.v0, (__imm)); \
+  __ret.v1 = _mm_shuffle_ps(__x.v1, __y.v1, (__imm)); \
+  __ret; })
+
+#define _mm256_permute_pd(__a, __imm) __extension__ ({ \
+  __m256d __x = (__a), __ret; \
+  __ret.v0 = _mm_permute_pd(__x.v0, (__imm) & 3); \
+  __ret.v1 = _mm_permute_pd(__x.v1, ((__imm) >> 2) & 3); \
+  __ret; })
+
+#define _mm256_permute_ps(__a, __imm) __extension__ ({ \
+  __m256 __x = (__a), __ret; \
+  __ret.v0 = _mm_permute_ps(__x.v0, (__imm)); \
+  __ret.v1 = _mm_permute_ps(__x.v1, (__imm)); \
+  __ret; })
+
+#define _mm256_cmp_pd(__a, __b, __imm) __extension__ ({ \
+  __m256d __x = (__a), __y = (__b), __ret; \
+  __ret.v0 = _mm_cmp_pd(__x.v0, __y.v0, (__imm)); \
+  __ret.v1 = _mm_cmp_pd(__x.v1, __y.v1, (__imm)); \
+  __ret; })
+
+#define _mm256_cmp_ps(__a, __b, __imm) __extension__ ({ \
+  __m256 __x = (__a), __y = (__b), __ret; \
+  __ret.v0 = _mm_cmp_ps(__x.v0, __y.v0, (__imm)); \
+  __ret.v1 = _mm_cmp_ps(__x.v1, __y.v1, (__imm)); \
+  __ret; })
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_permutevar_pd(__m256d __a, __m256i __c)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_permutevar_pd(__a.v0, (__m128d)__c.v0);
+  __ret.v1 = _mm_permutevar_pd(__a.v1, (__m128d)__c.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_permutevar_ps(__m256 __a, __m256i __c)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_permutevar_ps(__a.v0, (__m128)__c.v0);
+  __ret.v1 = _mm_permutevar_ps(__a.v1, (__m128)__c.v1);
+  return __ret;
+}
+
+// Selects one 128-bit half of the operands for _mm256_permute2f128_*: values
+// 0-3 of `__ctrl` pick a.v0, a.v1, b.v0 or b.v1, and bit 3 zeroes the result.
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+__avx_select_half(__m128i __a0, __m128i __a1, __m128i __b0, __m128i __b1, int __ctrl)
+{
+  if (__ctrl & 8)
+    return _mm_setzero_si128();
+  switch (__ctrl & 3) {
+    case 0: return __a0;
+    case 1: return __a1;
+    case 2: return __b0;
+    default: return __b1;
+  }
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_permute2f128_si256(__m256i __a, __m256i __b, const int __imm)
+{
+  __m256i __ret;
+  __ret.v0 = __avx_select_half(__a.v0, __a.v1, __b.v0, __b.v1, __imm);
+  __ret.v1 = __avx_select_half(__a.v0, __a.v1, __b.v0, __b.v1, __imm >> 4);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_permute2f128_pd(__m256d __a, __m256d __b, const int __imm)
+{
+  __m256d __ret;
+  __ret.v0 = (__m128d)__avx_select_half((__m128i)__a.v0, (__m128i)__a.v1, (__m128i)__b.v0, (__m128i)__b.v1, __imm);
+  __ret.v1 = (__m128d)__avx_select_half((__m128i)__a.v0, (__m128i)__a.v1, (__m128i)__b.v0, (__m128i)__b.v1, __imm >> 4);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_permute2f128_ps(__m256 __a, __m256 __b, const int __imm)
+{
+  __m256 __ret;
+  __ret.v0 = (__m128)__avx_select_half((__m128i)__a.v0, (__m128i)__a.v1, (__m128i)__b.v0, (__m128i)__b.v1, __imm);
+  __ret.v1 = (__m128)__avx_select_half((__m128i)__a.v0, (__m128i)__a.v1, (__m128i)__b.v0, (__m128i)__b.v1, __imm >> 4);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_moveldup_ps(__m256 __a)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_moveldup_ps(__a.v0);
+  __ret.v1 = _mm_moveldup_ps(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_movehdup_ps(__m256 __a)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_movehdup_ps(__a.v0);
+  __ret.v1 = _mm_movehdup_ps(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_movedup_pd(__m256d __a)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_movedup_pd(__a.v0);
+  __ret.v1 = _mm_movedup_pd(__a.v1);
+  return __ret;
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_movemask_pd(__m256d __a)
+{
+  return _mm_movemask_pd(__a.v0) | (_mm_movemask_pd(__a.v1) << 2);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_movemask_ps(__m256 __a)
+{
+  return _mm_movemask_ps(__a.v0) | (_mm_movemask_ps(__a.v1) << 4);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_testz_pd(__m256d __a, __m256d __b)
+{
+  return _mm_testz_pd(__a.v0, __b.v0) & _mm_testz_pd(__a.v1, __b.v1);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_testc_pd(__m256d __a, __m256d __b)
+{
+  return _mm_testc_pd(__a.v0, __b.v0) & _mm_testc_pd(__a.v1, __b.v1);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_testnzc_pd(__m256d __a, __m256d __b)
+{
+  return !_mm256_testz_pd(__a, __b) & !_mm256_testc_pd(__a, __b);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_testz_ps(__m256 __a, __m256 __b)
+{
+  return _mm_testz_ps(__a.v0, __b.v0) & _mm_testz_ps(__a.v1, __b.v1);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_testc_ps(__m256 __a, __m256 __b)
+{
+  return _mm_testc_ps(__a.v0, __b.v0) & _mm_testc_ps(__a.v1, __b.v1);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_testnzc_ps(__m256 __a, __m256 __b)
+{
+  return !_mm256_testz_ps(__a, __b) & !_mm256_testc_ps(__a, __b);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_testz_si256(__m256i __a, __m256i __b)
+{
+  return _mm_testz_si128(__a.v0, __b.v0) & _mm_testz_si128(__a.v1, __b.v1);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_testc_si256(__m256i __a, __m256i __b)
+{
+  return _mm_testc_si128(__a.v0, __b.v0) & _mm_testc_si128(__a.v1, __b.v1);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_testnzc_si256(__m256i __a, __m256i __b)
+{
+  return !_mm256_testz_si256(__a, __b) & !_mm256_testc_si256(__a, __b);
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepi32_pd(__m128i __a)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_cvtepi32_pd(__a);
+  __ret.v1 = _mm_cvtepi32_pd(_mm_unpackhi_epi64(__a, __a));
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtepi32_ps(__m256i __a)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_cvtepi32_ps(__a.v0);
+  __ret.v1 = _mm_cvtepi32_ps(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m128 __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtpd_ps(__m256d __a)
+{
+  return _mm_movelh_ps(_mm_cvtpd_ps(__a.v0), _mm_cvtpd_ps(__a.v1));
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtps_epi32(__m256 __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvtps_epi32(__a.v0);
+  __ret.v1 = _mm_cvtps_epi32(__a.v1);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtps_pd(__m128 __a)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_cvtps_pd(__a);
+  __ret.v1 = _mm_cvtps_pd(_mm_movehl_ps(__a, __a));
+  return __ret;
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvttpd_epi32(__m256d __a)
+{
+  return _mm_unpacklo_epi64(_mm_cvttpd_epi32(__a.v0), _mm_cvttpd_epi32(__a.v1));
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtpd_epi32(__m256d __a)
+{
+  return _mm_unpacklo_epi64(_mm_cvtpd_epi32(__a.v0), _mm_cvtpd_epi32(__a.v1));
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_cvttps_epi32(__m256 __a)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_cvttps_epi32(__a.v0);
+  __ret.v1 = _mm_cvttps_epi32(__a.v1);
+  return __ret;
+}
+
+static __inline__ double __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtsd_f64(__m256d __a)
+{
+  return _mm_cvtsd_f64(__a.v0);
+}
+
+static __inline__ int __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtsi256_si32(__m256i __a)
+{
+  return _mm_cvtsi128_si32(__a.v0);
+}
+
+static __inline__ float __attribute__((__always_inline__, __nodebug__))
+_mm256_cvtss_f32(__m256 __a)
+{
+  return _mm_cvtss_f32(__a.v0);
+}
+
+#define _mm256_extractf128_pd(__a, __imm) __extension__ ({ \
+  __m256d __x = (__a); \
+  ((__imm) & 1) ? __x.v1 : __x.v0; })
+
+#define _mm256_extractf128_ps(__a, __imm) __extension__ ({ \
+  __m256 __x = (__a); \
+  ((__imm) & 1) ? __x.v1 : __x.v0; })
+
+#define _mm256_extractf128_si256(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a); \
+  ((__imm) & 1) ? __x.v1 : __x.v0; })
+
+#define _mm256_insertf128_pd(__a, __b, __imm) __extension__ ({ \
+  __m256d __x = (__a); \
+  if ((__imm) & 1) __x.v1 = (__b); else __x.v0 = (__b); \
+  __x; })
+
+#define _mm256_insertf128_ps(__a, __b, __imm) __extension__ ({ \
+  __m256 __x = (__a); \
+  if ((__imm) & 1) __x.v1 = (__b); else __x.v0 = (__b); \
+  __x; })
+
+#define _mm256_insertf128_si256(__a, __b, __imm) __extension__ ({ \
+  __m256i __x = (__a); \
+  if ((__imm) & 1) __x.v1 = (__b); else __x.v0 = (__b); \
+  __x; })
+
+#define _mm256_extract_epi8(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a); \
+  _mm_extract_epi8(((__imm) & 16) ? __x.v1 : __x.v0, (__imm) & 15); })
+
+#define _mm256_extract_epi16(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a); \
+  _mm_extract_epi16(((__imm) & 8) ? __x.v1 : __x.v0, (__imm) & 7); })
+
+#define _mm256_extract_epi32(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a); \
+  _mm_extract_epi32(((__imm) & 4) ? __x.v1 : __x.v0, (__imm) & 3); })
+
+#define _mm256_extract_epi64(__a, __imm) __extension__ ({ \
+  __m256i __x = (__a); \
+  _mm_extract_epi64(((__imm) & 2) ? __x.v1 : __x.v0, (__imm) & 1); })
+
+#define _mm256_insert_epi8(__a, __i, __imm) __extension__ ({ \
+  __m256i __x = (__a); \
+  if ((__imm) & 16) __x.v1 = _mm_insert_epi8(__x.v1, (__i), (__imm) & 15); \
+  else __x.v0 = _mm_insert_epi8(__x.v0, (__i), (__imm) & 15); \
+  __x; })
+
+#define _mm256_insert_epi16(__a, __i, __imm) __extension__ ({ \
+  __m256i __x = (__a); \
+  if ((__imm) & 8) __x.v1 = _mm_insert_epi16(__x.v1, (__i), (__imm) & 7); \
+  else __x.v0 = _mm_insert_epi16(__x.v0, (__i), (__imm) & 7); \
+  __x; })
+
+#define _mm256_insert_epi32(__a, __i, __imm) __extension__ ({ \
+  __m256i __x = (__a); \
+  if ((__imm) & 4) __x.v1 = _mm_insert_epi32(__x.v1, (__i), (__imm) & 3); \
+  else __x.v0 = _mm_insert_epi32(__x.v0, (__i), (__imm) & 3); \
+  __x; })
+
+#define _mm256_insert_epi64(__a, __i, __imm) __extension__ ({ \
+  __m256i __x = (__a); \
+  if ((__imm) & 2) __x.v1 = _mm_insert_epi64(__x.v1, (__i), (__imm) & 1); \
+  else __x.v0 = _mm_insert_epi64(__x.v0, (__i), (__imm) & 1); \
+  __x; })
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcast_sd(const double *__mem_addr)
+{
+  __m256d __ret;
+  __ret.v1 = __ret.v0 = _mm_load1_pd(__mem_addr);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcast_ss(const float *__mem_addr)
+{
+  __m256 __ret;
+  __ret.v1 = __ret.v0 = _mm_broadcast_ss(__mem_addr);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcast_pd(const __m128d *__mem_addr)
+{
+  __m256d __ret;
+  __ret.v1 = __ret.v0 = _mm_loadu_pd((const double *)__mem_addr);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_broadcast_ps(const __m128 *__mem_addr)
+{
+  __m256 __ret;
+  __ret.v1 = __ret.v0 = _mm_loadu_ps((const float *)__mem_addr);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_load_pd(const double *__p)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_load_pd(__p);
+  __ret.v1 = _mm_load_pd(__p + 2);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_load_ps(const float *__p)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_load_ps(__p);
+  __ret.v1 = _mm_load_ps(__p + 4);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_loadu_pd(const double *__p)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_loadu_pd(__p);
+  __ret.v1 = _mm_loadu_pd(__p + 2);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_loadu_ps(const float *__p)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_loadu_ps(__p);
+  __ret.v1 = _mm_loadu_ps(__p + 4);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_load_si256(const __m256i *__p)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_load_si128((const __m128i *)__p);
+  __ret.v1 = _mm_load_si128((const __m128i *)__p + 1);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_loadu_si256(const __m256i_u *__p)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_loadu_si128((const __m128i *)__p);
+  __ret.v1 = _mm_loadu_si128((const __m128i *)__p + 1);
+  return __ret;
+}
+
+#define _mm256_lddqu_si256 _mm256_loadu_si256
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_store_pd(double *__p, __m256d __a)
+{
+  _mm_store_pd(__p, __a.v0);
+  _mm_store_pd(__p + 2, __a.v1);
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_store_ps(float *__p, __m256 __a)
+{
+  _mm_store_ps(__p, __a.v0);
+  _mm_store_ps(__p + 4, __a.v1);
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_storeu_pd(double *__p, __m256d __a)
+{
+  _mm_storeu_pd(__p, __a.v0);
+  _mm_storeu_pd(__p + 2, __a.v1);
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_storeu_ps(float *__p, __m256 __a)
+{
+  _mm_storeu_ps(__p, __a.v0);
+  _mm_storeu_ps(__p + 4, __a.v1);
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_store_si256(__m256i *__p, __m256i __a)
+{
+  _mm_store_si128((__m128i *)__p, __a.v0);
+  _mm_store_si128((__m128i *)__p + 1, __a.v1);
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_storeu_si256(__m256i_u *__p, __m256i __a)
+{
+  _mm_storeu_si128((__m128i *)__p, __a.v0);
+  _mm_storeu_si128((__m128i *)__p + 1, __a.v1);
+}
+
+#define _mm256_stream_pd _mm256_store_pd
+#define _mm256_stream_ps _mm256_store_ps
+#define _mm256_stream_si256 _mm256_store_si256
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_maskload_pd(const double *__p, __m256i __mask)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_maskload_pd(__p, __mask.v0);
+  __ret.v1 = _mm_maskload_pd(__p + 2, __mask.v1);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_maskload_ps(const float *__p, __m256i __mask)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_maskload_ps(__p, __mask.v0);
+  __ret.v1 = _mm_maskload_ps(__p + 4, __mask.v1);
+  return __ret;
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_maskstore_pd(double *__p, __m256i __mask, __m256d __a)
+{
+  _mm_maskstore_pd(__p, __mask.v0, __a.v0);
+  _mm_maskstore_pd(__p + 2, __mask.v1, __a.v1);
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__, DIAGNOSE_SLOW))
+_mm256_maskstore_ps(float *__p, __m256i __mask, __m256 __a)
+{
+  _mm_maskstore_ps(__p, __mask.v0, __a.v0);
+  _mm_maskstore_ps(__p + 4, __mask.v1, __a.v1);
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_loadu2_m128(const float *__addr_hi, const float *__addr_lo)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_loadu_ps(__addr_lo);
+  __ret.v1 = _mm_loadu_ps(__addr_hi);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_loadu2_m128d(const double *__addr_hi, const double *__addr_lo)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_loadu_pd(__addr_lo);
+  __ret.v1 = _mm_loadu_pd(__addr_hi);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_loadu2_m128i(const __m128i *__addr_hi, const __m128i *__addr_lo)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_loadu_si128(__addr_lo);
+  __ret.v1 = _mm_loadu_si128(__addr_hi);
+  return __ret;
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_storeu2_m128(float *__addr_hi, float *__addr_lo, __m256 __a)
+{
+  _mm_storeu_ps(__addr_lo, __a.v0);
+  _mm_storeu_ps(__addr_hi, __a.v1);
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_storeu2_m128d(double *__addr_hi, double *__addr_lo, __m256d __a)
+{
+  _mm_storeu_pd(__addr_lo, __a.v0);
+  _mm_storeu_pd(__addr_hi, __a.v1);
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_storeu2_m128i(__m128i *__addr_hi, __m128i *__addr_lo, __m256i __a)
+{
+  _mm_storeu_si128(__addr_lo, __a.v0);
+  _mm_storeu_si128(__addr_hi, __a.v1);
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_set_pd(double __a, double __b, double __c, double __d)
+{
+  __m256d __ret;
+  __ret.v0 = _mm_set_pd(__c, __d);
+  __ret.v1 = _mm_set_pd(__a, __b);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_set_ps(float __a, float __b, float __c, float __d,
+              float __e, float __f, float __g, float __h)
+{
+  __m256 __ret;
+  __ret.v0 = _mm_set_ps(__e, __f, __g, __h);
+  __ret.v1 = _mm_set_ps(__a, __b, __c, __d);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_set_epi32(int __i0, int __i1, int __i2, int __i3,
+                 int __i4, int __i5, int __i6, int __i7)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_set_epi32(__i4, __i5, __i6, __i7);
+  __ret.v1 = _mm_set_epi32(__i0, __i1, __i2, __i3);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_set_epi16(short __w15, short __w14, short __w13, short __w12,
+                 short __w11, short __w10, short __w09, short __w08,
+                 short __w07, short __w06, short __w05, short __w04,
+                 short __w03, short __w02, short __w01, short __w00)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_set_epi16(__w07, __w06, __w05, __w04, __w03, __w02, __w01, __w00);
+  __ret.v1 = _mm_set_epi16(__w15, __w14, __w13, __w12, __w11, __w10, __w09, __w08);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_set_epi8(char __b31, char __b30, char __b29, char __b28,
+                char __b27, char __b26, char __b25, char __b24,
+                char __b23, char __b22, char __b21, char __b20,
+                char __b19, char __b18, char __b17, char __b16,
+                char __b15, char __b14, char __b13, char __b12,
+                char __b11, char __b10, char __b09, char __b08,
+                char __b07, char __b06, char __b05, char __b04,
+                char __b03, char __b02, char __b01, char __b00)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_set_epi8(__b15, __b14, __b13, __b12, __b11, __b10, __b09, __b08,
+                          __b07, __b06, __b05, __b04, __b03, __b02, __b01, __b00);
+  __ret.v1 = _mm_set_epi8(__b31, __b30, __b29, __b28, __b27, __b26, __b25, __b24,
+                          __b23, __b22, __b21, __b20, __b19, __b18, __b17, __b16);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_set_epi64x(long long __a, long long __b, long long __c, long long __d)
+{
+  __m256i __ret;
+  __ret.v0 = _mm_set_epi64x(__c, __d);
+  __ret.v1 = _mm_set_epi64x(__a, __b);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_setr_pd(double __a, double __b, double __c, double __d)
+{
+  return _mm256_set_pd(__d, __c, __b, __a);
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_setr_ps(float __a, float __b, float __c, float __d,
+               float __e, float __f, float __g, float __h)
+{
+  return _mm256_set_ps(__h, __g, __f, __e, __d, __c, __b, __a);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_setr_epi32(int __i0, int __i1, int __i2, int __i3,
+                  int __i4, int __i5, int __i6, int __i7)
+{
+  return _mm256_set_epi32(__i7, __i6, __i5, __i4, __i3, __i2, __i1, __i0);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_setr_epi16(short __w15, short __w14, short __w13, short __w12,
+                  short __w11, short __w10, short __w09, short __w08,
+                  short __w07, short __w06, short __w05, short __w04,
+                  short __w03, short __w02, short __w01, short __w00)
+{
+  return _mm256_set_epi16(__w00, __w01, __w02, __w03, __w04, __w05, __w06, __w07,
+                          __w08, __w09, __w10, __w11, __w12, __w13, __w14, __w15);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_setr_epi8(char __b31, char __b30, char __b29, char __b28,
+                 char __b27, char __b26, char __b25, char __b24,
+                 char __b23, char __b22, char __b21, char __b20,
+                 char __b19, char __b18, char __b17, char __b16,
+                 char __b15, char __b14, char __b13, char __b12,
+                 char __b11, char __b10, char __b09, char __b08,
+                 char __b07, char __b06, char __b05, char __b04,
+                 char __b03, char __b02, char __b01, char __b00)
+{
+  return _mm256_set_epi8(__b00, __b01, __b02, __b03, __b04, __b05, __b06, __b07,
+                         __b08, __b09, __b10, __b11, __b12, __b13, __b14, __b15,
+                         __b16, __b17, __b18, __b19, __b20, __b21, __b22, __b23,
+                         __b24, __b25, __b26, __b27, __b28, __b29, __b30, __b31);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_setr_epi64x(long long __a, long long __b, long long __c, long long __d)
+{
+  return _mm256_set_epi64x(__d, __c, __b, __a);
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_set1_pd(double __w)
+{
+  __m256d __ret;
+  __ret.v1 = __ret.v0 = _mm_set1_pd(__w);
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_set1_ps(float __w)
+{
+  __m256 __ret;
+  __ret.v1 = __ret.v0 = _mm_set1_ps(__w);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_set1_epi32(int __i)
+{
+  __m256i __ret;
+  __ret.v1 = __ret.v0 = _mm_set1_epi32(__i);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_set1_epi16(short __w)
+{
+  __m256i __ret;
+  __ret.v1 = __ret.v0 = _mm_set1_epi16(__w);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_set1_epi8(char __b)
+{
+  __m256i __ret;
+  __ret.v1 = __ret.v0 = _mm_set1_epi8(__b);
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_set1_epi64x(long long __q)
+{
+  __m256i __ret;
+  __ret.v1 = __ret.v0 = _mm_set1_epi64x(__q);
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_setzero_pd(void)
+{
+  __m256d __ret;
+  __ret.v1 = __ret.v0 = _mm_setzero_pd();
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_setzero_ps(void)
+{
+  __m256 __ret;
+  __ret.v1 = __ret.v0 = _mm_setzero_ps();
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_setzero_si256(void)
+{
+  __m256i __ret;
+  __ret.v1 = __ret.v0 = _mm_setzero_si128();
+  return __ret;
+}
+
+#define _mm256_undefined_pd _mm256_setzero_pd
+#define _mm256_undefined_ps _mm256_setzero_ps
+#define _mm256_undefined_si256 _mm256_setzero_si256
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_set_m128(__m128 __hi, __m128 __lo)
+{
+  __m256 __ret;
+  __ret.v0 = __lo;
+  __ret.v1 = __hi;
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_set_m128d(__m128d __hi, __m128d __lo)
+{
+  __m256d __ret;
+  __ret.v0 = __lo;
+  __ret.v1 = __hi;
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_set_m128i(__m128i __hi, __m128i __lo)
+{
+  __m256i __ret;
+  __ret.v0 = __lo;
+  __ret.v1 = __hi;
+  return __ret;
+}
+
+#define _mm256_setr_m128(__lo, __hi) _mm256_set_m128((__hi), (__lo))
+#define _mm256_setr_m128d(__lo, __hi) _mm256_set_m128d((__hi), (__lo))
+#define _mm256_setr_m128i(__lo, __hi) _mm256_set_m128i((__hi), (__lo))
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_castpd_ps(__m256d __a)
+{
+  __m256 __ret;
+  __ret.v0 = (__m128)__a.v0;
+  __ret.v1 = (__m128)__a.v1;
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_castpd_si256(__m256d __a)
+{
+  __m256i __ret;
+  __ret.v0 = (__m128i)__a.v0;
+  __ret.v1 = (__m128i)__a.v1;
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_castps_pd(__m256 __a)
+{
+  __m256d __ret;
+  __ret.v0 = (__m128d)__a.v0;
+  __ret.v1 = (__m128d)__a.v1;
+  return __ret;
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_castps_si256(__m256 __a)
+{
+  __m256i __ret;
+  __ret.v0 = (__m128i)__a.v0;
+  __ret.v1 = (__m128i)__a.v1;
+  return __ret;
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_castsi256_ps(__m256i __a)
+{
+  __m256 __ret;
+  __ret.v0 = (__m128)__a.v0;
+  __ret.v1 = (__m128)__a.v1;
+  return __ret;
+}
+
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_castsi256_pd(__m256i __a)
+{
+  __m256d __ret;
+  __ret.v0 = (__m128d)__a.v0;
+  __ret.v1 = (__m128d)__a.v1;
+  return __ret;
+}
+
+static __inline__ __m128d __attribute__((__always_inline__, __nodebug__))
+_mm256_castpd256_pd128(__m256d __a)
+{
+  return __a.v0;
+}
+
+static __inline__ __m128 __attribute__((__always_inline__, __nodebug__))
+_mm256_castps256_ps128(__m256 __a)
+{
+  return __a.v0;
+}
+
+static __inline__ __m128i __attribute__((__always_inline__, __nodebug__))
+_mm256_castsi256_si128(__m256i __a)
+{
+  return __a.v0;
+}
+
+// The upper half is undefined for the 128 to 256-bit casts; this zeroes it,
+// which makes them identical to the zext versions.
+static __inline__ __m256d __attribute__((__always_inline__, __nodebug__))
+_mm256_castpd128_pd256(__m128d __a)
+{
+  return _mm256_set_m128d(_mm_setzero_pd(), __a);
+}
+
+static __inline__ __m256 __attribute__((__always_inline__, __nodebug__))
+_mm256_castps128_ps256(__m128 __a)
+{
+  return _mm256_set_m128(_mm_setzero_ps(), __a);
+}
+
+static __inline__ __m256i __attribute__((__always_inline__, __nodebug__))
+_mm256_castsi128_si256(__m128i __a)
+{
+  return _mm256_set_m128i(_mm_setzero_si128(), __a);
+}
+
+#define _mm256_zextpd128_pd256 _mm256_castpd128_pd256
+#define _mm256_zextps128_ps256 _mm256_castps128_ps256
+#define _mm256_zextsi128_si256 _mm256_castsi128_si256
+
+// There are no upper register halves to clear in Wasm.
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_zeroall(void)
+{
+}
+
+static __inline__ void __attribute__((__always_inline__, __nodebug__))
+_mm256_zeroupper(void)
+{
+}
+
 #endif /* __emscripten_avxintrin_h__ */
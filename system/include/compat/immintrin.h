@@ -7,6 +7,10 @@
 #ifndef __emscripten_immintrin_h__
 #define __emscripten_immintrin_h__
 
+#ifdef __AVX2__
+#include <avx2intrin.h>
+#endif
+
 #ifdef __AVX__
 #include <avxintrin.h>
 #endif
@@ -37,6 +37,52 @@ size_t emscripten_get_heap_size(void);
 // Returns the max size of the WebAssembly heap.
 size_t emscripten_get_heap_max(void);
 
+// Controls how sbrk() (and therefore malloc) grows the heap at runtime.
+typedef struct emscripten_heap_growth_policy {
+  // Fraction of the current heap size to overallocate by at each step, e.g.
+  // 0.2 to grow by +20%.  Ignored if `linear_step` is non-zero.
+  double geometric_step;
+  // The maximum number of bytes to overallocate by when growing geometrically,
+  // or 0 for no limit.
+  size_t geometric_cap;
+  // If non-zero, grow by this many bytes at a time rather than geometrically.
+  size_t linear_step;
+  // Grow the heap as soon as fewer than this many bytes remain free above the
+  // sbrk pointer, rather than waiting until an allocation does not fit.
+  size_t reserve_ahead;
+  // If set, the growth triggered by `reserve_ahead` happens on a dedicated
+  // background thread so that the allocating thread never waits for it.  Only
+  // available with -pthread; the thread is started by
+  // emscripten_set_heap_growth_policy() and needs a free worker.  It exits
+  // once a policy without `background` (or NULL) is set.
+  int background;
+} emscripten_heap_growth_policy;
+
+// Replaces the MEMORY_GROWTH_GEOMETRIC_STEP, MEMORY_GROWTH_GEOMETRIC_CAP and
+// MEMORY_GROWTH_LINEAR_STEP link-time settings with `policy`, or restores them
+// if `policy` is NULL.  This has no effect unless the heap can grow (see
+// ALLOW_MEMORY_GROWTH).  Returns 0 on success, or an errno value if the
+// background thread could not be started.
+int emscripten_set_heap_growth_policy(const emscripten_heap_growth_policy* policy);
+
+typedef struct emscripten_heap_growth_stats {
+  // Number of times an allocation had to wait for the heap to grow.
+  size_t sync_grows;
+  // Number of times the heap was grown ahead of time due to `reserve_ahead`,
+  // including those done on the background thread.
+  size_t early_grows;
+  // Number of times the JS heap views (HEAP8 etc.) on the calling thread were
+  // found to be stale and had to be recreated.  This only happens in builds
+  // with both -pthread and ALLOW_MEMORY_GROWTH, where another thread may have
+  // grown the memory.
+  size_t view_refreshes;
+} emscripten_heap_growth_stats;
+
+// Fills in `stats`.  Growth by sbrk() is only counted once
+// emscripten_set_heap_growth_policy() has been called (with any policy,
+// including NULL).
+void emscripten_get_heap_growth_stats(emscripten_heap_growth_stats* stats);
+
 // Direct access to the system allocator.  Use these to access that underlying
 // allocator when intercepting/wrapping the allocator API.  Works with with both
 // dlmalloc and emmalloc.
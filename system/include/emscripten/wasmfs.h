@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <sys/stat.h>
+#include <sys/types.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -86,6 +87,36 @@ backend_t wasmfs_create_icase_backend(backend_t backend);
 // printed out.
 void wasmfs_flush(void);
 
+// Asynchronous file operations
+//
+// These submit an operation and return immediately. The operation is then
+// performed on a background thread (in builds with pthreads) and `callback` is
+// called with its result on the submitting thread, from the event loop. This
+// lets the main browser thread use backends that would otherwise block it, like
+// OPFS or fetch, without JSPI. Operations are performed in the order in which
+// they are submitted, and buffers passed to them must remain valid until the
+// callback is called.
+//
+// `result` is what the corresponding synchronous function would return, except
+// that errors are reported as a negative errno value: the new file descriptor
+// for open, the number of bytes transferred for read and write (which behave
+// like pread and pwrite), and 0 for stat and close. If the background thread
+// cannot be started the operation is not performed and fails with -EAGAIN. If
+// the submitting thread exits before an operation completes, its callback is
+// not called (and a file opened for it is closed again).
+typedef void (*wasmfs_async_callback_t)(void* user_data, ssize_t result);
+
+void wasmfs_async_open(const char* path __attribute__((nonnull)), int flags, mode_t mode, wasmfs_async_callback_t callback, void* user_data);
+void wasmfs_async_read(int fd, void* buf, size_t len, off_t offset, wasmfs_async_callback_t callback, void* user_data);
+void wasmfs_async_write(int fd, const void* buf, size_t len, off_t offset, wasmfs_async_callback_t callback, void* user_data);
+void wasmfs_async_stat(const char* path __attribute__((nonnull)), struct stat* buf, wasmfs_async_callback_t callback, void* user_data);
+void wasmfs_async_close(int fd, wasmfs_async_callback_t callback, void* user_data);
+
+// A callback for the functions above that takes a promise created with
+// `emscripten_promise_create` as its `user_data`, and fulfills it with the
+// result, or rejects it with the (positive) errno value on failure.
+void wasmfs_async_resolve_promise(void* promise, ssize_t result);
+
 // Hooks
 
 // A hook users can do to create the root directory. Overriding this allows the
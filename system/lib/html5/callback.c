@@ -6,6 +6,13 @@
  */
 #include <assert.h>
 #include <emscripten/html5.h>
+#include <emscripten/threading.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "emscripten_internal.h"
 
@@ -21,6 +28,8 @@ typedef struct callback_args_t {
 static void do_callback(void* arg) {
   callback_args_t* args = (callback_args_t*)arg;
   args->callback(args->event_type, args->event_data, args->user_data);
+  // The event data is allocated by the caller for each proxied event.
+  free(args->event_data);
 }
 
 void _emscripten_run_callback_on_thread(pthread_t t,
@@ -40,3 +49,346 @@ void _emscripten_run_callback_on_thread(pthread_t t,
     assert(false && "emscripten_proxy_sync failed");
   }
 }
+
+// Event ring
+// ==========
+//
+// A thread that has called `emscripten_html5_enable_event_ring` receives its
+// proxied input events through a fixed size single-producer single-consumer
+// ring rather than through one blocking proxied call per event.  The producer
+// is always the main browser thread (where the DOM event handlers run) and the
+// consumer is the thread that owns the ring.
+//
+// Events that arrive while the ring is full go to an unbounded overflow list
+// behind it instead, and so do all further events until the consumer has taken
+// the list, so that events are always delivered in order.
+
+#define EVENT_RING_SIZE 128
+
+// Slot states.  A published slot is READY until the consumer claims it, at
+// which point it becomes TAKEN.  The producer moves a READY slot to WRITING
+// while it coalesces a newer event into it.
+#define SLOT_READY 0
+#define SLOT_WRITING 1
+#define SLOT_TAKEN 2
+
+typedef union event_data_t {
+  EmscriptenKeyboardEvent key;
+  EmscriptenMouseEvent mouse;
+  EmscriptenWheelEvent wheel;
+} event_data_t;
+
+typedef struct event_slot_t {
+  _Atomic int state;
+  int event_type;
+  event_callback callback;
+  void* user_data;
+  event_data_t data;
+} event_slot_t;
+
+typedef struct overflow_event_t {
+  struct overflow_event_t* next;
+  int event_type;
+  event_callback callback;
+  void* user_data;
+  event_data_t data;
+} overflow_event_t;
+
+typedef struct event_ring_t {
+  pthread_t thread;
+  // Written by the consumer, read by the producer.
+  _Atomic int flags;
+  // Only written by the consumer.
+  _Atomic uint32_t head;
+  // Only written by the producer.
+  _Atomic uint32_t tail;
+  // Set while a drain task is queued on the owning thread, so that a burst of
+  // events results in a single proxied call.
+  _Atomic int drain_pending;
+  // The overflow list, oldest first.  `has_overflow` is set while it is not
+  // empty, so that the producer can check for it without taking the lock.
+  pthread_mutex_t overflow_lock;
+  overflow_event_t* overflow_head;
+  overflow_event_t** overflow_tail;
+  _Atomic int has_overflow;
+  event_slot_t slots[EVENT_RING_SIZE];
+} event_ring_t;
+
+#define MAX_EVENT_RINGS 32
+
+static _Atomic(event_ring_t*) event_rings[MAX_EVENT_RINGS];
+
+static pthread_key_t event_ring_key;
+static pthread_once_t event_ring_key_once = PTHREAD_ONCE_INIT;
+
+static event_ring_t* find_event_ring(pthread_t t) {
+  for (int i = 0; i < MAX_EVENT_RINGS; i++) {
+    event_ring_t* ring = event_rings[i];
+    if (ring && ring->thread == t) {
+      return ring;
+    }
+  }
+  return NULL;
+}
+
+static void free_overflow(overflow_event_t* event) {
+  while (event) {
+    overflow_event_t* next = event->next;
+    free(event);
+    event = next;
+  }
+}
+
+static void free_event_ring(void* arg) {
+  // Runs on the main thread, which is the only producer, so no push can be in
+  // progress.
+  event_ring_t* ring = arg;
+  free_overflow(ring->overflow_head);
+  pthread_mutex_destroy(&ring->overflow_lock);
+  free(ring);
+}
+
+static void destroy_event_ring(void* arg) {
+  event_ring_t* ring = arg;
+  for (int i = 0; i < MAX_EVENT_RINGS; i++) {
+    event_ring_t* expected = ring;
+    if (atomic_compare_exchange_strong(&event_rings[i], &expected, NULL)) {
+      break;
+    }
+  }
+  // The main thread may be in the middle of pushing to this ring, so hand the
+  // final free over to it.
+  em_proxying_queue* q = emscripten_proxy_get_system_queue();
+  if (!emscripten_proxy_async(
+        q, emscripten_main_runtime_thread_id(), free_event_ring, ring)) {
+    free_event_ring(ring);
+  }
+}
+
+static void create_event_ring_key(void) {
+  pthread_key_create(&event_ring_key, destroy_event_ring);
+}
+
+EMSCRIPTEN_RESULT emscripten_html5_enable_event_ring(int flags) {
+  if (emscripten_is_main_browser_thread()) {
+    // Events targeting the main thread are never proxied.
+    return EMSCRIPTEN_RESULT_NOT_SUPPORTED;
+  }
+  pthread_once(&event_ring_key_once, create_event_ring_key);
+  event_ring_t* ring = pthread_getspecific(event_ring_key);
+  if (ring) {
+    atomic_store(&ring->flags, flags);
+    return EMSCRIPTEN_RESULT_SUCCESS;
+  }
+  ring = calloc(1, sizeof(event_ring_t));
+  if (!ring) {
+    return EMSCRIPTEN_RESULT_FAILED;
+  }
+  ring->thread = pthread_self();
+  atomic_init(&ring->flags, flags);
+  pthread_mutex_init(&ring->overflow_lock, NULL);
+  ring->overflow_tail = &ring->overflow_head;
+  for (int i = 0; i < MAX_EVENT_RINGS; i++) {
+    event_ring_t* expected = NULL;
+    if (atomic_compare_exchange_strong(&event_rings[i], &expected, ring)) {
+      pthread_setspecific(event_ring_key, ring);
+      return EMSCRIPTEN_RESULT_SUCCESS;
+    }
+  }
+  pthread_mutex_destroy(&ring->overflow_lock);
+  free(ring);
+  return EMSCRIPTEN_RESULT_FAILED;
+}
+
+int emscripten_html5_process_event_ring(void) {
+  if (emscripten_is_main_browser_thread()) {
+    return 0;
+  }
+  pthread_once(&event_ring_key_once, create_event_ring_key);
+  event_ring_t* ring = pthread_getspecific(event_ring_key);
+  if (!ring) {
+    return 0;
+  }
+  // Clear the pending flag before looking at the ring so that any event
+  // published after this point either gets seen below or schedules a new
+  // drain.
+  atomic_store(&ring->drain_pending, 0);
+
+  int count = 0;
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  while (1) {
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    while (head != tail) {
+      event_slot_t* slot = &ring->slots[head % EVENT_RING_SIZE];
+      // The producer only holds a slot in the WRITING state for the duration
+      // of a memcpy, so spinning here is brief.
+      int expected = SLOT_READY;
+      while (
+        !atomic_compare_exchange_weak(&slot->state, &expected, SLOT_TAKEN)) {
+        expected = SLOT_READY;
+      }
+      int event_type = slot->event_type;
+      event_callback callback = slot->callback;
+      void* user_data = slot->user_data;
+      event_data_t data = slot->data;
+      atomic_store_explicit(&ring->head, ++head, memory_order_release);
+
+      callback(event_type, &data, user_data);
+      count++;
+
+      if (head == tail) {
+        tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+      }
+    }
+
+    // The ring is empty, so any overflowed events come next.  Taking the list
+    // lets the producer use the ring again, for events that are newer than all
+    // of the ones taken.
+    if (!atomic_load(&ring->has_overflow)) {
+      break;
+    }
+    pthread_mutex_lock(&ring->overflow_lock);
+    if (atomic_load_explicit(&ring->tail, memory_order_acquire) != head) {
+      // The producer pushed to the ring before it saw the overflow, so those
+      // events are older.
+      pthread_mutex_unlock(&ring->overflow_lock);
+      continue;
+    }
+    overflow_event_t* overflow = ring->overflow_head;
+    ring->overflow_head = NULL;
+    ring->overflow_tail = &ring->overflow_head;
+    atomic_store(&ring->has_overflow, 0);
+    pthread_mutex_unlock(&ring->overflow_lock);
+
+    for (overflow_event_t* event = overflow; event; event = event->next) {
+      event->callback(event->event_type, &event->data, event->user_data);
+      count++;
+    }
+    free_overflow(overflow);
+  }
+  return count;
+}
+
+static void drain_event_ring(void* arg) {
+  emscripten_html5_process_event_ring();
+}
+
+static bool try_coalesce(event_ring_t* ring,
+                         int flags,
+                         uint32_t head,
+                         uint32_t tail,
+                         event_callback f,
+                         int event_type,
+                         const void* event_data,
+                         void* user_data) {
+  if (!(flags & EM_EVENT_RING_COALESCE_MOVES) ||
+      event_type != EMSCRIPTEN_EVENT_MOUSEMOVE || head == tail) {
+    return false;
+  }
+  event_slot_t* last = &ring->slots[(tail - 1) % EVENT_RING_SIZE];
+  if (last->event_type != event_type || last->callback != f ||
+      last->user_data != user_data) {
+    return false;
+  }
+  // Fails if the consumer has already claimed the slot.
+  int expected = SLOT_READY;
+  if (!atomic_compare_exchange_strong(&last->state, &expected, SLOT_WRITING)) {
+    return false;
+  }
+  // Keep the relative motion of the dropped event so that pointer lock
+  // movement is not lost.
+  int movementX = last->data.mouse.movementX;
+  int movementY = last->data.mouse.movementY;
+  memcpy(&last->data.mouse, event_data, sizeof(EmscriptenMouseEvent));
+  last->data.mouse.movementX += movementX;
+  last->data.mouse.movementY += movementY;
+  atomic_store(&last->state, SLOT_READY);
+  return true;
+}
+
+// Append an event to the overflow list.  The caller holds `overflow_lock`.
+static bool push_overflow(event_ring_t* ring,
+                          event_callback f,
+                          int event_type,
+                          const void* event_data,
+                          size_t event_size,
+                          void* user_data) {
+  overflow_event_t* event = malloc(sizeof(overflow_event_t));
+  if (!event) {
+    return false;
+  }
+  event->next = NULL;
+  event->event_type = event_type;
+  event->callback = f;
+  event->user_data = user_data;
+  memcpy(&event->data, event_data, event_size);
+  *ring->overflow_tail = event;
+  ring->overflow_tail = &event->next;
+  return true;
+}
+
+static void schedule_drain(event_ring_t* ring, int flags) {
+  if (!(flags & EM_EVENT_RING_MANUAL_DRAIN) &&
+      !atomic_exchange(&ring->drain_pending, 1)) {
+    em_proxying_queue* q = emscripten_proxy_get_system_queue();
+    if (!emscripten_proxy_async(q, ring->thread, drain_event_ring, NULL)) {
+      atomic_store(&ring->drain_pending, 0);
+    }
+  }
+}
+
+// Called from JS on the main thread.  Returns false if the target thread has no
+// ring (or an overflowed event could not be allocated), in which case the
+// caller falls back to `_emscripten_run_callback_on_thread`.
+bool _emscripten_html5_event_ring_push(pthread_t t,
+                                       event_callback f,
+                                       int event_type,
+                                       const void* event_data,
+                                       size_t event_size,
+                                       void* user_data) {
+  event_ring_t* ring = find_event_ring(t);
+  if (!ring || event_size > sizeof(event_data_t)) {
+    return false;
+  }
+  int flags = atomic_load(&ring->flags);
+  if (atomic_load(&ring->has_overflow)) {
+    // Once events overflow, newer ones must queue behind them.
+    pthread_mutex_lock(&ring->overflow_lock);
+    if (atomic_load(&ring->has_overflow)) {
+      bool pushed =
+        push_overflow(ring, f, event_type, event_data, event_size, user_data);
+      pthread_mutex_unlock(&ring->overflow_lock);
+      schedule_drain(ring, flags);
+      return pushed;
+    }
+    // The consumer has just taken the list.
+    pthread_mutex_unlock(&ring->overflow_lock);
+  }
+  uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+  if (try_coalesce(
+        ring, flags, head, tail, f, event_type, event_data, user_data)) {
+    // Nothing more to do.
+  } else if (tail - head == EVENT_RING_SIZE) {
+    pthread_mutex_lock(&ring->overflow_lock);
+    bool pushed =
+      push_overflow(ring, f, event_type, event_data, event_size, user_data);
+    if (pushed) {
+      atomic_store(&ring->has_overflow, 1);
+    }
+    pthread_mutex_unlock(&ring->overflow_lock);
+    if (!pushed) {
+      return false;
+    }
+  } else {
+    event_slot_t* slot = &ring->slots[tail % EVENT_RING_SIZE];
+    slot->event_type = event_type;
+    slot->callback = f;
+    slot->user_data = user_data;
+    memcpy(&slot->data, event_data, event_size);
+    atomic_store_explicit(&slot->state, SLOT_READY, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+  }
+  schedule_drain(ring, flags);
+  return true;
+}
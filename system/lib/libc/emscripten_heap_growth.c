@@ -0,0 +1,261 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+// Runtime control over how sbrk() grows the heap.  See
+// emscripten_set_heap_growth_policy in emscripten/heap.h.
+
+#include <errno.h>
+#include <stdint.h>
+#include <emscripten/heap.h>
+#ifdef __EMSCRIPTEN_PTHREADS__
+#include <math.h>
+#include <pthread.h>
+#include <emscripten/threading.h>
+#endif
+
+#include "emscripten_internal.h"
+#include "lock.h"
+
+// Hooks called by sbrk.
+extern int (*_Atomic __sbrk_grow_heap)(size_t requested);
+extern void (*_Atomic __sbrk_check_reserve)(uintptr_t brk);
+
+#ifdef __EMSCRIPTEN_SHARED_MEMORY__
+#define READ_SBRK_PTR(sbrk_ptr) (__c11_atomic_load((_Atomic(uintptr_t)*)(sbrk_ptr), __ATOMIC_SEQ_CST))
+#define COUNT(counter) (__c11_atomic_fetch_add((_Atomic(size_t)*)&(counter), 1, __ATOMIC_RELAXED))
+#else
+#define READ_SBRK_PTR(sbrk_ptr) (*(sbrk_ptr))
+#define COUNT(counter) ((counter)++)
+#endif
+
+// Without a policy, growth is left to emscripten_resize_heap(), which follows
+// the MEMORY_GROWTH_* settings.  The policy is guarded by a musl-style lock
+// (LOCK/UNLOCK), since sbrk() may read it on any thread while it is replaced.
+// `has_growth_policy` can be checked without the lock.
+static volatile int lock[1];
+static emscripten_heap_growth_policy growth_policy;
+static _Atomic(int) has_growth_policy;
+
+static emscripten_heap_growth_stats growth_stats;
+
+// Copies the current policy into `policy`, and returns whether there is one.
+static int get_policy(emscripten_heap_growth_policy* policy) {
+  if (!has_growth_policy) {
+    return 0;
+  }
+  LOCK(lock);
+  int has = has_growth_policy;
+  *policy = growth_policy;
+  UNLOCK(lock);
+  return has;
+}
+
+// Applies the growth policy to a request for at least `requested` bytes of
+// heap, given that there are currently `old_size`.
+static size_t growth_target(const emscripten_heap_growth_policy* policy,
+                            size_t old_size,
+                            size_t requested) {
+  size_t max = emscripten_get_heap_max();
+  size_t target;
+  if (policy->linear_step) {
+    if (old_size >= max || policy->linear_step > max - old_size) {
+      target = max;
+    } else {
+      target = old_size + policy->linear_step;
+    }
+  } else {
+    // Clamp in double, as converting a value that doesn't fit in size_t is
+    // undefined.
+    double grown = old_size + old_size * policy->geometric_step;
+    target = grown >= (double)max ? max : (size_t)grown;
+    if (policy->geometric_cap && target > requested &&
+        target - requested > policy->geometric_cap) {
+      target = requested + policy->geometric_cap;
+    }
+  }
+  if (target < requested) {
+    target = requested;
+  }
+  return target > max ? max : target;
+}
+
+// Grows the wasm memory to at least `size` bytes without any overallocation.
+// Concurrent callers may both grow, which wastes some space but is otherwise
+// harmless.
+static int grow_memory(size_t size) {
+  size_t old_size = emscripten_get_heap_size();
+  if (size <= old_size) {
+    return 1;
+  }
+  size_t pages = (size - old_size + WASM_PAGE_SIZE - 1) / WASM_PAGE_SIZE;
+  if (__builtin_wasm_memory_grow(0, pages) == (size_t)-1) {
+    return 0;
+  }
+  emscripten_notify_memory_growth(0);
+  return 1;
+}
+
+// Grows the heap to at least `requested` bytes for an allocation that cannot
+// proceed until it is.
+static int grow_heap(size_t requested) {
+  COUNT(growth_stats.sync_grows);
+  emscripten_heap_growth_policy policy;
+  if (!get_policy(&policy)) {
+    return emscripten_resize_heap(requested);
+  }
+  size_t old_size = emscripten_get_heap_size();
+  if (requested <= old_size) {
+    // Another thread grew the heap in the meantime.
+    return 1;
+  }
+  if (requested <= emscripten_get_heap_max() &&
+      grow_memory(growth_target(&policy, old_size, requested))) {
+    return 1;
+  }
+  // Let emscripten_resize_heap() try smaller steps, and report the failure
+  // as configured (e.g. ABORTING_MALLOC).
+  return emscripten_resize_heap(requested);
+}
+
+// Grows the heap if fewer than `reserve_ahead` bytes are free above `brk`.
+// Failing is not an error here: the next allocation that doesn't fit will try
+// again, and report it.
+static void grow_heap_ahead(const emscripten_heap_growth_policy* policy,
+                            uintptr_t brk) {
+  size_t wanted = brk + policy->reserve_ahead;
+  if (wanted < brk) {
+    wanted = SIZE_MAX;
+  }
+  size_t old_size = emscripten_get_heap_size();
+  if (wanted <= old_size || old_size >= emscripten_get_heap_max()) {
+    return;
+  }
+  if (grow_memory(growth_target(policy, old_size, wanted))) {
+    COUNT(growth_stats.early_grows);
+  }
+}
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+// The background thread runs while the policy has `background` set.  These are
+// guarded by `lock`.
+static int growth_thread_running;
+static int growth_thread_exit;
+// Set to wake the background thread.
+static _Atomic(uint32_t) growth_requested;
+
+static void* growth_thread_main(void* arg) {
+  while (1) {
+    emscripten_futex_wait(&growth_requested, 0, INFINITY);
+    if (!__c11_atomic_exchange(&growth_requested, 0, __ATOMIC_SEQ_CST)) {
+      continue;
+    }
+    LOCK(lock);
+    if (growth_thread_exit) {
+      growth_thread_exit = 0;
+      growth_thread_running = 0;
+      UNLOCK(lock);
+      return NULL;
+    }
+    emscripten_heap_growth_policy policy = growth_policy;
+    UNLOCK(lock);
+    grow_heap_ahead(&policy, READ_SBRK_PTR(emscripten_get_sbrk_ptr()));
+  }
+  return NULL;
+}
+
+static void wake_growth_thread() {
+  if (!__c11_atomic_exchange(&growth_requested, 1, __ATOMIC_SEQ_CST)) {
+    emscripten_futex_wake(&growth_requested, 1);
+  }
+}
+
+// Starts the background thread, or keeps it if it is running.  Called without
+// `lock` held, since creating a thread may allocate.
+static int start_growth_thread() {
+  LOCK(lock);
+  // Cancel a pending exit, which the thread only acts on under the lock.
+  growth_thread_exit = 0;
+  int running = growth_thread_running;
+  growth_thread_running = 1;
+  UNLOCK(lock);
+  if (running) {
+    return 0;
+  }
+  pthread_t thread;
+  int rc = pthread_create(&thread, NULL, growth_thread_main, NULL);
+  if (rc) {
+    LOCK(lock);
+    growth_thread_running = 0;
+    UNLOCK(lock);
+    return rc;
+  }
+  pthread_detach(thread);
+  return 0;
+}
+
+// Asks the background thread to exit.  Called with `lock` held.
+static void stop_growth_thread() {
+  if (growth_thread_running && !growth_thread_exit) {
+    growth_thread_exit = 1;
+    wake_growth_thread();
+  }
+}
+#endif
+
+// Called after each successful sbrk().
+static void check_reserve(uintptr_t brk) {
+  emscripten_heap_growth_policy policy;
+  if (!get_policy(&policy) ||
+      emscripten_get_heap_size() - brk >= policy.reserve_ahead) {
+    return;
+  }
+#ifdef __EMSCRIPTEN_PTHREADS__
+  if (policy.background) {
+    wake_growth_thread();
+    return;
+  }
+#endif
+  grow_heap_ahead(&policy, brk);
+}
+
+int emscripten_set_heap_growth_policy(const emscripten_heap_growth_policy* policy) {
+  __sbrk_grow_heap = grow_heap;
+  __sbrk_check_reserve = check_reserve;
+  if (policy && !(policy->geometric_step >= 0)) {
+    return EINVAL;
+  }
+  if (policy && policy->background) {
+#ifdef __EMSCRIPTEN_PTHREADS__
+    int rc = start_growth_thread();
+    if (rc) {
+      return rc;
+    }
+#else
+    return ENOTSUP;
+#endif
+  }
+  LOCK(lock);
+#ifdef __EMSCRIPTEN_PTHREADS__
+  if (!policy || !policy->background) {
+    stop_growth_thread();
+  }
+#endif
+  if (policy) {
+    growth_policy = *policy;
+  }
+  has_growth_policy = policy != NULL;
+  UNLOCK(lock);
+  if (policy) {
+    check_reserve(READ_SBRK_PTR(emscripten_get_sbrk_ptr()));
+  }
+  return 0;
+}
+
+void emscripten_get_heap_growth_stats(emscripten_heap_growth_stats* stats) {
+  *stats = growth_stats;
+  stats->view_refreshes = _emscripten_get_heap_view_refreshes();
+}
@@ -43,6 +43,10 @@ void* _emscripten_memset_bulkmem(void* ptr, char value, size_t n);
 
 void emscripten_notify_memory_growth(size_t memory_index);
 
+// Number of times the GROWABLE_HEAP_* helpers found the JS heap views on the
+// calling thread to be stale.
+uint32_t _emscripten_get_heap_view_refreshes(void);
+
 time_t _timegm_js(struct tm* tm);
 time_t _mktime_js(struct tm* tm);
 void _localtime_js(time_t t, struct tm* __restrict__ tm);
@@ -56,6 +56,20 @@ uintptr_t* emscripten_get_sbrk_ptr() {
 #define READ_SBRK_PTR(sbrk_ptr) (*(sbrk_ptr))
 #endif
 
+// Installed by emscripten_set_heap_growth_policy() (see
+// emscripten_heap_growth.c), so that programs which don't use it don't pay for
+// it.
+int (*_Atomic __sbrk_grow_heap)(size_t requested);
+void (*_Atomic __sbrk_check_reserve)(uintptr_t brk);
+
+static int grow_heap(size_t requested) {
+  int (*hook)(size_t) = __sbrk_grow_heap;
+  if (hook) {
+    return hook(requested);
+  }
+  return emscripten_resize_heap(requested);
+}
+
 void *sbrk(intptr_t increment_) {
   uintptr_t increment = (uintptr_t)increment_;
   increment = (increment + (SBRK_ALIGNMENT-1)) & ~(SBRK_ALIGNMENT-1);
@@ -70,7 +84,7 @@ void *sbrk(intptr_t increment_) {
     // allocate over maximum addressable memory. and b) if necessary,
     // increase the WebAssembly Memory size, and abort if that fails.
     if ((increment > 0 && new_brk <= old_brk)
-     || (new_brk > emscripten_get_heap_size() && !emscripten_resize_heap(new_brk))) {
+     || (new_brk > emscripten_get_heap_size() && !grow_heap(new_brk))) {
       errno = ENOMEM;
       return (void*)-1;
     }
@@ -88,6 +102,11 @@ void *sbrk(intptr_t increment_) {
     *sbrk_ptr = new_brk;
 #endif
 
+    void (*check_reserve)(uintptr_t) = __sbrk_check_reserve;
+    if (check_reserve) {
+      check_reserve(new_brk);
+    }
+
     emscripten_memprof_sbrk_grow(old_brk, new_brk);
     return (void*)old_brk;
   }
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <string.h>
+
+#include "simd_string.h"
+
+void* memchr(const void* src, int c, size_t n) {
+  if (!n) {
+    return NULL;
+  }
+  size_t align = (uintptr_t)src & 15;
+  const unsigned char* p = align_down16(src);
+  v128_t needle = wasm_i8x16_splat(c);
+  uint32_t mask = wasm_i8x16_bitmask(wasm_i8x16_eq(wasm_v128_load(p), needle));
+  mask &= 0xffff << align;
+  // The number of bytes left to search, counted from `p`.  Callers such as
+  // strnlen may pass SIZE_MAX for `n`, in which case this saturates.
+  size_t remaining = n > SIZE_MAX - 16 ? SIZE_MAX : n + align;
+  while (1) {
+    if (remaining <= 16) {
+      mask &= 0xffff >> (16 - remaining);
+      return mask ? (void*)(p + __builtin_ctz(mask)) : NULL;
+    }
+    if (mask) {
+      return (void*)(p + __builtin_ctz(mask));
+    }
+    p += 16;
+    remaining -= 16;
+    mask = wasm_i8x16_bitmask(wasm_i8x16_eq(wasm_v128_load(p), needle));
+  }
+}
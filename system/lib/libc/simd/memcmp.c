@@ -0,0 +1,27 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <string.h>
+
+#include "simd_string.h"
+
+// Both buffers are known to be at least `n` bytes long, so this uses
+// unaligned loads and never reads past the end of either.
+int memcmp(const void* vl, const void* vr, size_t n) {
+  const unsigned char* l = vl;
+  const unsigned char* r = vr;
+  for (; n >= 16; n -= 16, l += 16, r += 16) {
+    uint32_t mask = wasm_i8x16_bitmask(
+      wasm_i8x16_ne(wasm_v128_load(l), wasm_v128_load(r)));
+    if (mask) {
+      size_t i = __builtin_ctz(mask);
+      return l[i] - r[i];
+    }
+  }
+  for (; n && *l == *r; n--, l++, r++);
+  return n ? *l - *r : 0;
+}
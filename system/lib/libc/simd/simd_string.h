@@ -0,0 +1,64 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+// Shared helpers for the wasm SIMD128 string routines in this directory.
+//
+// Scanning routines read the string in 16-byte blocks starting from the
+// aligned block that contains its first byte.  An aligned block never straddles
+// the end of linear memory, whose size is always a multiple of the wasm page
+// size, so reading the whole of it is safe even where the string ends part way
+// through.  Bits for bytes before the start of the string are shifted out of
+// the match mask.  These over-reads are why libsimdstring is not used with
+// ASan or SAFE_HEAP.
+
+#pragma once
+
+#include <stdint.h>
+#include <wasm_simd128.h>
+
+#define WASM_PAGE_SIZE 65536
+
+static inline const unsigned char* align_down16(const void* p) {
+  return (const unsigned char*)((uintptr_t)p & ~(uintptr_t)15);
+}
+
+// Bit mask of bytes in `v` that are zero.
+static inline uint32_t zero_mask(v128_t v) {
+  return wasm_i8x16_bitmask(wasm_i8x16_eq(v, wasm_i8x16_splat(0)));
+}
+
+// A 256-bit byte set, stored as two nibble lookup tables.  For a byte with
+// low nibble `lo` and high nibble `hi`, bit `hi & 7` of `table[hi >> 3][lo]`
+// says whether the byte is in the set.
+typedef struct byteset {
+  v128_t table[2];
+} byteset;
+
+static inline void byteset_init(byteset* set, const char* chars, int with_nul) {
+  uint8_t table[2][16] = {0};
+  if (with_nul) {
+    table[0][0] = 1;
+  }
+  for (const unsigned char* c = (const unsigned char*)chars; *c; c++) {
+    table[*c >> 7][*c & 15] |= 1 << ((*c >> 4) & 7);
+  }
+  set->table[0] = wasm_v128_load(table[0]);
+  set->table[1] = wasm_v128_load(table[1]);
+}
+
+// Bit mask of bytes in `v` that are members of `set`.
+static inline uint32_t byteset_match(const byteset* set, v128_t v) {
+  v128_t lo = wasm_v128_and(v, wasm_i8x16_splat(15));
+  v128_t row = wasm_v128_bitselect(wasm_i8x16_swizzle(set->table[1], lo),
+                                   wasm_i8x16_swizzle(set->table[0], lo),
+                                   wasm_i8x16_lt(v, wasm_i8x16_splat(0)));
+  v128_t bit = wasm_i8x16_swizzle(
+    wasm_u8x16_const(1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128),
+    wasm_u8x16_shr(v, 4));
+  v128_t hit = wasm_v128_and(row, bit);
+  return wasm_i8x16_bitmask(wasm_i8x16_ne(hit, wasm_i8x16_splat(0)));
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <string.h>
+
+#include "simd_string.h"
+
+// strchr itself comes from musl, which implements it in terms of this.
+char* __strchrnul(const char* s, int c) {
+  c = (unsigned char)c;
+  if (!c) {
+    return (char*)s + strlen(s);
+  }
+  size_t align = (uintptr_t)s & 15;
+  const unsigned char* p = align_down16(s);
+  v128_t needle = wasm_i8x16_splat(c);
+  v128_t v = wasm_v128_load(p);
+  uint32_t mask =
+    wasm_i8x16_bitmask(wasm_i8x16_eq(v, needle)) | zero_mask(v);
+  mask >>= align;
+  if (mask) {
+    return (char*)s + __builtin_ctz(mask);
+  }
+  while (1) {
+    p += 16;
+    v = wasm_v128_load(p);
+    mask = wasm_i8x16_bitmask(wasm_i8x16_eq(v, needle)) | zero_mask(v);
+    if (mask) {
+      return (char*)p + __builtin_ctz(mask);
+    }
+  }
+}
+
+weak_alias(__strchrnul, strchrnul);
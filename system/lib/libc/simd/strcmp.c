@@ -0,0 +1,43 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <string.h>
+
+#include "simd_string.h"
+
+int strcmp(const char* sl, const char* sr) {
+  const unsigned char* l = (const unsigned char*)sl;
+  const unsigned char* r = (const unsigned char*)sr;
+  // Only one of the strings can be read in aligned blocks, so align `l` and
+  // use unaligned loads for `r`.  Those may read past the end of `r`, which is
+  // only unsafe if the load crosses into the next wasm page (which may be past
+  // the end of memory); in that case compare the block a byte at a time.
+  for (; (uintptr_t)l & 15; l++, r++) {
+    if (*l != *r || !*l) {
+      return *l - *r;
+    }
+  }
+  while (1) {
+    if (((uintptr_t)r & (WASM_PAGE_SIZE - 1)) > WASM_PAGE_SIZE - 16) {
+      for (int i = 0; i < 16; i++, l++, r++) {
+        if (*l != *r || !*l) {
+          return *l - *r;
+        }
+      }
+      continue;
+    }
+    v128_t a = wasm_v128_load(l);
+    v128_t b = wasm_v128_load(r);
+    uint32_t mask = wasm_i8x16_bitmask(wasm_i8x16_ne(a, b)) | zero_mask(a);
+    if (mask) {
+      size_t i = __builtin_ctz(mask);
+      return l[i] - r[i];
+    }
+    l += 16;
+    r += 16;
+  }
+}
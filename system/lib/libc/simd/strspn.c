@@ -0,0 +1,32 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <string.h>
+
+#include "simd_string.h"
+
+size_t strspn(const char* s, const char* c) {
+  if (!c[0]) {
+    return 0;
+  }
+  byteset set;
+  byteset_init(&set, c, 0);
+  // NUL is never in the set, so the span always stops at the terminator.
+  size_t align = (uintptr_t)s & 15;
+  const unsigned char* p = align_down16(s);
+  uint32_t mask = (~byteset_match(&set, wasm_v128_load(p)) & 0xffff) >> align;
+  if (mask) {
+    return __builtin_ctz(mask);
+  }
+  while (1) {
+    p += 16;
+    mask = ~byteset_match(&set, wasm_v128_load(p)) & 0xffff;
+    if (mask) {
+      return p + __builtin_ctz(mask) - (const unsigned char*)s;
+    }
+  }
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+// String helpers used by the JS glue (UTF8ToString, UTF16ToString) when
+// libsimdstring is linked in.  Scanning a long string for its terminator and
+// decoding UTF-8 without TextDecoder are both much faster here than one byte
+// at a time in JS.  Decoding gives the same result as the JS fallback in
+// UTF8ArrayToString, so it doesn't matter which of them a string goes through.
+
+#include <string.h>
+
+#include "simd_string.h"
+
+// Returns the length of the NUL-terminated UTF-8 string at `s`, but no more
+// than `max`.
+size_t _emscripten_utf8_length(const char* s, size_t max) {
+  const char* end = memchr(s, 0, max);
+  return end ? end - s : max;
+}
+
+// Returns the length in code units of the NUL-terminated UTF-16 string at `s`,
+// which must be 2-byte aligned, but no more than `max`.
+size_t _emscripten_utf16_length(const uint16_t* s, size_t max) {
+  if (!max) {
+    return 0;
+  }
+  size_t align = ((uintptr_t)s & 15) / 2;
+  const uint16_t* p = (const uint16_t*)align_down16(s);
+  v128_t zero = wasm_i16x8_splat(0);
+  uint32_t mask = wasm_i16x8_bitmask(wasm_i16x8_eq(wasm_v128_load(p), zero));
+  mask &= 0xff << align;
+  // The number of code units left to search, counted from `p`.
+  size_t remaining = max > SIZE_MAX - 8 ? SIZE_MAX : max + align;
+  while (1) {
+    if (remaining <= 8) {
+      mask &= 0xff >> (8 - remaining);
+      return mask ? p + __builtin_ctz(mask) - s : max;
+    }
+    if (mask) {
+      return p + __builtin_ctz(mask) - s;
+    }
+    p += 8;
+    remaining -= 8;
+    mask = wasm_i16x8_bitmask(wasm_i16x8_eq(wasm_v128_load(p), zero));
+  }
+}
+
+// Returns the byte at `p`.  Like UTF8ArrayToString, the decoder below reads
+// the continuation bytes of a truncated sequence from past the end of the
+// string, and those past the end of memory read as 0.
+static inline unsigned char byte_at(const unsigned char* p) {
+  return (uintptr_t)p < __builtin_wasm_memory_size(0) * 65536 ? *p : 0;
+}
+
+// Decodes the UTF-8 sequence starting at `s[0]` into `*cp`, and returns the
+// number of bytes consumed.  This matches UTF8ArrayToString, which is used for
+// short strings: it only looks at the leading byte to know the length of a
+// sequence, so it accepts surrogates (as written by stringToUTF8 for lone
+// surrogates) and overlong forms, and never produces U+FFFD.  Code points above
+// U+10FFFF are left for the caller to truncate like String.fromCharCode does.
+static size_t decode_utf8(const unsigned char* s, uint32_t* cp) {
+  uint32_t u0 = s[0];
+  if (!(u0 & 0x80)) {
+    *cp = u0;
+    return 1;
+  }
+  uint32_t u1 = byte_at(s + 1) & 63;
+  if ((u0 & 0xe0) == 0xc0) {
+    *cp = ((u0 & 31) << 6) | u1;
+    return 2;
+  }
+  uint32_t u2 = byte_at(s + 2) & 63;
+  if ((u0 & 0xf0) == 0xe0) {
+    *cp = ((u0 & 15) << 12) | (u1 << 6) | u2;
+    return 3;
+  }
+  *cp = ((u0 & 7) << 18) | (u1 << 12) | (u2 << 6) | (byte_at(s + 3) & 63);
+  return 4;
+}
+
+// Converts `len` bytes of UTF-8 at `s` to UTF-16 at `out`, which must have
+// room for `len + 1` code units (a 4-byte leading byte at the very end yields
+// two).  Returns the number of code units written.
+size_t _emscripten_utf8_to_utf16(const char* s, size_t len, uint16_t* out) {
+  const unsigned char* src = (const unsigned char*)s;
+  size_t i = 0;
+  uint16_t* dst = out;
+  while (i < len) {
+    // ASCII fast path: widen 16 bytes at a time.
+    if (len - i >= 16) {
+      v128_t v = wasm_v128_load(src + i);
+      if (!wasm_i8x16_bitmask(v)) {
+        wasm_v128_store(dst, wasm_u16x8_extend_low_u8x16(v));
+        wasm_v128_store(dst + 8, wasm_u16x8_extend_high_u8x16(v));
+        i += 16;
+        dst += 16;
+        continue;
+      }
+    }
+    // Decode up to the end of this block one sequence at a time, then try the
+    // fast path again.
+    size_t block_end = len - i >= 16 ? i + 16 : len;
+    while (i < block_end) {
+      uint32_t cp;
+      i += decode_utf8(src + i, &cp);
+      if (cp < 0x10000) {
+        *dst++ = cp;
+      } else {
+        cp -= 0x10000;
+        *dst++ = 0xd800 | (cp >> 10);
+        *dst++ = 0xdc00 | (cp & 0x3ff);
+      }
+    }
+  }
+  return dst - out;
+}
@@ -6,18 +6,156 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <__algorithm/max.h>
 #include <__algorithm/min.h>
 #include <__algorithm/pstl_backends/cpu_backends/libdispatch.h>
 #include <__config>
+#ifdef __EMSCRIPTEN__
+#include <atomic>
+#include <emscripten/threading.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#else
 #include <dispatch/dispatch.h>
+#endif
 
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 namespace __par_backend::inline __libdispatch {
 
+#ifdef __EMSCRIPTEN__
+// XXX EMSCRIPTEN: There is no libdispatch on the web, so implement
+// dispatch_apply on top of a pool of pthreads.
+//
+// Each call publishes a job and then starts running chunks itself.  Idle pool
+// threads join any published job and claim chunks from the same atomic
+// counter, so the work is balanced dynamically between all participants.  As
+// the calling thread always takes part it never waits for a thread that has
+// not started yet (which, on the web, may only happen once the main thread
+// yields to the event loop), and nested calls from inside a chunk work too.
+//
+// Pool threads are created on demand, up to one less than the number of
+// logical cores, and exit after being idle for a while so that they don't
+// keep the runtime alive.
+namespace {
+
+struct __job {
+  void* __context_;
+  void (*__func_)(void*, size_t);
+  size_t __chunk_count_;
+  std::atomic<size_t> __next_chunk_{0};
+  // Number of pool threads working on this job, guarded by __pool_mutex.
+  int __workers_ = 0;
+  __job* __next_     = nullptr;
+  __job* __prev_     = nullptr;
+
+  void __run_chunks() {
+    size_t __chunk;
+    while ((__chunk = __next_chunk_.fetch_add(1, std::memory_order_relaxed)) < __chunk_count_)
+      __func_(__context_, __chunk);
+  }
+};
+
+constexpr int __idle_timeout_ms = 1000;
+
+pthread_mutex_t __pool_mutex  = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t __work_cond    = PTHREAD_COND_INITIALIZER;
+pthread_cond_t __workers_cond = PTHREAD_COND_INITIALIZER;
+// Jobs that still have unclaimed chunks.
+__job* __jobs     = nullptr;
+int __max_threads = -1;
+int __threads     = 0;
+int __idle        = 0;
+
+void __unlink(__job* __j) {
+  if (__j->__prev_)
+    __j->__prev_->__next_ = __j->__next_;
+  else if (__jobs == __j)
+    __jobs = __j->__next_;
+  if (__j->__next_)
+    __j->__next_->__prev_ = __j->__prev_;
+  __j->__next_ = __j->__prev_ = nullptr;
+}
+
+void* __worker_main(void*) {
+  pthread_mutex_lock(&__pool_mutex);
+  while (true) {
+    if (__job* __j = __jobs) {
+      __j->__workers_++;
+      pthread_mutex_unlock(&__pool_mutex);
+      __j->__run_chunks();
+      pthread_mutex_lock(&__pool_mutex);
+      // All chunks are claimed, don't let anyone else join.
+      __unlink(__j);
+      if (--__j->__workers_ == 0)
+        pthread_cond_broadcast(&__workers_cond);
+      continue;
+    }
+    timespec __deadline;
+    clock_gettime(CLOCK_REALTIME, &__deadline);
+    __deadline.tv_sec += __idle_timeout_ms / 1000;
+    __idle++;
+    int __ret = pthread_cond_timedwait(&__work_cond, &__pool_mutex, &__deadline);
+    __idle--;
+    if (__ret == ETIMEDOUT && !__jobs)
+      break;
+  }
+  __threads--;
+  pthread_mutex_unlock(&__pool_mutex);
+  return nullptr;
+}
+
+} // namespace
+
+void __dispatch_apply(size_t chunk_count, void* context, void (*func)(void* context, size_t chunk)) noexcept {
+  if (chunk_count <= 1) {
+    if (chunk_count)
+      func(context, 0);
+    return;
+  }
+
+  __job __j;
+  __j.__context_     = context;
+  __j.__func_        = func;
+  __j.__chunk_count_ = chunk_count;
+
+  pthread_mutex_lock(&__pool_mutex);
+  if (__max_threads < 0)
+    __max_threads = std::max(emscripten_num_logical_cores(), 1) - 1;
+  __j.__next_ = __jobs;
+  if (__jobs)
+    __jobs->__prev_ = &__j;
+  __jobs = &__j;
+  // Wake up idle threads and start new ones for what is left over.
+  int __wanted = static_cast<int>(std::min<size_t>(chunk_count - 1, __max_threads));
+  int __wake   = std::min(__wanted, __idle);
+  for (int __i = 0; __i < __wake; __i++)
+    pthread_cond_signal(&__work_cond);
+  while (__threads < __wanted) {
+    pthread_t __tid;
+    if (pthread_create(&__tid, nullptr, __worker_main, nullptr) != 0)
+      break;
+    pthread_detach(__tid);
+    __threads++;
+  }
+  pthread_mutex_unlock(&__pool_mutex);
+
+  __j.__run_chunks();
+
+  // Every chunk has been claimed; wait for the pool threads that are still
+  // running theirs.
+  pthread_mutex_lock(&__pool_mutex);
+  __unlink(&__j);
+  while (__j.__workers_)
+    pthread_cond_wait(&__workers_cond, &__pool_mutex);
+  pthread_mutex_unlock(&__pool_mutex);
+}
+#else
 void __dispatch_apply(size_t chunk_count, void* context, void (*func)(void* context, size_t chunk)) noexcept {
   ::dispatch_apply_f(chunk_count, DISPATCH_APPLY_AUTO, context, func);
 }
+#endif
 
 __chunk_partitions __partition_chunks(ptrdiff_t element_count) noexcept {
   __chunk_partitions partitions;
@@ -15,100 +15,102 @@
 #include "threading_internal.h"
 #include "pthread_impl.h"
 
-extern void* _emscripten_main_thread_futex;
+// Bounds for the number of times a busy waiter checks for a wakeup before it
+// starts calling _emscripten_yield() between checks.
+#define MIN_SPIN 16
+#define MAX_SPIN 4096
+
+static _Thread_local int spin_limit = MIN_SPIN;
+
+static int claim_busy_wait_slot(volatile void* addr) {
+  // Count ourselves before claiming a slot: a waker that sees a count of zero
+  // and skips the slots must then have changed the value before we check it.
+  __c11_atomic_fetch_add(&_emscripten_futex_busy_waiter_count, 1, __ATOMIC_SEQ_CST);
+  for (int i = 0; i < EM_FUTEX_BUSY_WAIT_SLOTS; i++) {
+    void* expected = 0;
+    if (__c11_atomic_compare_exchange_strong(&_emscripten_futex_busy_waiters[i],
+                                             &expected,
+                                             (void*)addr,
+                                             __ATOMIC_SEQ_CST,
+                                             __ATOMIC_SEQ_CST)) {
+      return i;
+    }
+  }
+  __c11_atomic_fetch_sub(&_emscripten_futex_busy_waiter_count, 1, __ATOMIC_SEQ_CST);
+  return -1;
+}
+
+// Free the slot and return whether we were woken through it.
+static int release_busy_wait_slot(int slot) {
+  void* last = __c11_atomic_exchange(&_emscripten_futex_busy_waiters[slot], 0, __ATOMIC_SEQ_CST);
+  __c11_atomic_fetch_sub(&_emscripten_futex_busy_waiter_count, 1, __ATOMIC_SEQ_CST);
+  return (uintptr_t)last & 1;
+}
 
 static int futex_wait_main_browser_thread(volatile void* addr,
                                           uint32_t val,
                                           double timeout) {
   // Atomics.wait is not available in the main browser thread, so simulate it
   // via busy spinning.
-  double now = emscripten_get_now();
-  double end = now + timeout;
-
-  // Register globally which address the main thread is simulating to be waiting
-  // on. When zero, the main thread is not waiting on anything, and on nonzero,
-  // the contents of the address pointed by _emscripten_main_thread_futex tell
-  // which address the main thread is simulating its wait on.  We need to be
-  // careful of recursion here: If we wait on a futex, and then call
-  // _emscripten_yield() below, that will call code that takes the proxying
-  // mutex - which can once more reach this code in a nested call. To avoid
-  // interference between the two (there is just a single
-  // _emscripten_main_thread_futex at a time), unmark ourselves before calling
-  // the potentially-recursive call. See below for how we handle the case of our
-  // futex being notified during the time in between when we are not set as the
-  // value of _emscripten_main_thread_futex.
-  void* last_addr = a_cas_p(&_emscripten_main_thread_futex, 0, (void*)addr);
-  // We must not have already been waiting.
-  assert(last_addr == 0);
+  double end = emscripten_get_now() + timeout;
+
+  // Register the address we are waiting on so that emscripten_futex_wake can
+  // find us. Each wait claims its own slot, so this also works when we recurse
+  // into here from the _emscripten_yield() call below (which runs proxied work
+  // that may take a lock): the outer wait stays registered while the inner one
+  // runs, and a wakeup for it in the meantime is not lost.  In the unlikely
+  // case that all the slots are taken we just watch the value at the address.
+  int slot = claim_busy_wait_slot(addr);
 
+  // Wakeups often follow quickly, e.g. when a worker hands over a mutex, so
+  // first spin on just the value and our slot, which keeps the handoff
+  // latency low. After that, check for timeouts and handle proxied events
+  // from pthreads between checks, to avoid deadlocks. How long we spin adapts
+  // to whether recent waits ended while spinning. A wait without a timeout
+  // is just a check of the value, so it does not spin at all.
+  int limit = timeout > 0 ? spin_limit : 0;
+  int spins = 0;
+  int ret;
   while (1) {
-    // Check for a timeout.
-    now = emscripten_get_now();
-    if (now > end) {
-      // We timed out, so stop marking ourselves as waiting.
-      last_addr = a_cas_p(&_emscripten_main_thread_futex, (void*)addr, 0);
-      // The current value must have been our address which we set, or
-      // in a race it was set to 0 which means another thread just allowed
-      // us to run, but (tragically) that happened just a bit too late.
-      assert(last_addr == addr || last_addr == 0);
-      return -ETIMEDOUT;
+    if (slot >= 0 &&
+        ((uintptr_t)__c11_atomic_load(&_emscripten_futex_busy_waiters[slot],
+                                      __ATOMIC_SEQ_CST) & 1)) {
+      ret = 0;
+      break;
     }
-    // We are performing a blocking loop here, so we must handle proxied
-    // events from pthreads, to avoid deadlocks.
-    // Note that we have to do so carefully, as we may take a lock while
-    // doing so, which can recurse into this function; stop marking
-    // ourselves as waiting while we do so.
-    last_addr = a_cas_p(&_emscripten_main_thread_futex, (void*)addr, 0);
-    assert(last_addr == addr || last_addr == 0);
-    if (last_addr == 0) {
-      // We were told to stop waiting, so stop.
+    // Checking the memory value of the futex is valid to do at any point: we
+    // could just as well have been delayed and only started waiting now.
+    if (__c11_atomic_load((_Atomic uint32_t*)addr, __ATOMIC_SEQ_CST) != val) {
+      ret = -EWOULDBLOCK;
+      break;
+    }
+    if (spins < limit) {
+      spins++;
+      continue;
+    }
+    double now = emscripten_get_now();
+    if (now > end) {
+      ret = -ETIMEDOUT;
       break;
     }
     _emscripten_yield(now);
+  }
 
-    // Check the value, as if we were starting the futex all over again.
-    // This handles the following case:
-    //
-    //  * wait on futex A
-    //  * recurse into _emscripten_yield(),
-    //    which waits on futex B. that sets the _emscripten_main_thread_futex
-    //    address to futex B, and there is no longer any mention of futex A.
-    //  * a worker is done with futex A. it checks _emscripten_main_thread_futex
-    //    but does not see A, so it does nothing special for the main thread.
-    //  * a worker is done with futex B. it flips mainThreadMutex from B
-    //    to 0, ending the wait on futex B.
-    //  * we return to the wait on futex A. _emscripten_main_thread_futex is 0,
-    //    but that is because of futex B being done - we can't tell from
-    //    _emscripten_main_thread_futex whether A is done or not. therefore,
-    //    check the memory value of the futex.
-    //
-    // That case motivates the design here. Given that, checking the memory
-    // address is also necessary for other reasons: we unset and re-set our
-    // address in _emscripten_main_thread_futex around calls to
-    // _emscripten_yield(), and a worker could
-    // attempt to wake us up right before/after such times.
-    //
-    // Note that checking the memory value of the futex is valid to do: we
-    // could easily have been delayed (relative to the worker holding on
-    // to futex A), which means we could be starting all of our work at the
-    // later time when there is no need to block. The only "odd" thing is
-    // that we may have caused side effects in that "delay" time. But the
-    // only side effects we can have are to call
-    // _emscripten_yield(). That is always ok to
-    // do on the main thread (it's why it is ok for us to call it in the
-    // middle of this function, and elsewhere). So if we check the value
-    // here and return, it's the same is if what happened on the main thread
-    // was the same as calling _emscripten_yield()
-    // a few times before calling emscripten_futex_wait().
-    if (__c11_atomic_load((_Atomic uint32_t*)addr, __ATOMIC_SEQ_CST) != val) {
-      return -EWOULDBLOCK;
-    }
+  if (slot >= 0 && release_busy_wait_slot(slot)) {
+    // We were woken just as we timed out. The waker counted us as woken, so
+    // report that.
+    ret = 0;
+  }
 
-    // Mark us as waiting once more, and continue the loop.
-    last_addr = a_cas_p(&_emscripten_main_thread_futex, 0, (void*)addr);
-    assert(last_addr == 0);
+  if (!limit) {
+    return ret;
   }
-  return 0;
+  if (spins < limit) {
+    spin_limit = MIN(spin_limit * 2, MAX_SPIN);
+  } else {
+    spin_limit = MAX(spin_limit / 2, MIN_SPIN);
+  }
+  return ret;
 }
 
 int emscripten_futex_wait(volatile void *addr, uint32_t val, double max_wait_ms) {
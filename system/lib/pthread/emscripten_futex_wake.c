@@ -11,9 +11,10 @@
 #include <atomic.h>
 #include <emscripten/threading.h>
 
-// Stores the memory address that the main thread is waiting on, if any. If
-// the main thread is waiting, we wake it up before waking up any workers.
-void* _emscripten_main_thread_futex;
+#include "pthread_impl.h"
+
+_Atomic(void*) _emscripten_futex_busy_waiters[EM_FUTEX_BUSY_WAIT_SLOTS];
+_Atomic int _emscripten_futex_busy_waiter_count;
 
 // Returns the number of threads (>= 0) woken up, or the value -EINVAL on error.
 // Pass count == INT_MAX to wake up all threads.
@@ -25,19 +26,24 @@ int emscripten_futex_wake(volatile void *addr, int count) {
     return 0;
   }
 
-  // See if main thread is waiting on this address? If so, wake it up by
-  // resetting its wake location to zero.  Note that this is not a fair
-  // procedure, since we always wake main thread first before any workers, so
-  // this scheme does not adhere to real queue-based waiting.
-  int main_thread_woken = 0;
-  if (a_cas_p(&_emscripten_main_thread_futex, (void*)addr, 0) == addr) {
-    // The main browser thread must never try to wake itself up!
-    assert(!emscripten_is_main_browser_thread());
-    if (count != INT_MAX) {
-      --count;
-      main_thread_woken = 1;
-      if (count <= 0) {
-        return 1;
+  // See if the main thread (or another thread that cannot use Atomics.wait) is
+  // busy waiting on this address. If so, wake it up by marking its slot.  Note
+  // that this is not a fair procedure, since we always wake busy waiters first
+  // before any workers, so this scheme does not adhere to real queue-based
+  // waiting.
+  int busy_woken = 0;
+  if (__c11_atomic_load(&_emscripten_futex_busy_waiter_count, __ATOMIC_SEQ_CST)) {
+    for (int i = 0; i < EM_FUTEX_BUSY_WAIT_SLOTS; i++) {
+      void* expected = (void*)addr;
+      if (__c11_atomic_compare_exchange_strong(&_emscripten_futex_busy_waiters[i],
+                                               &expected,
+                                               (void*)((uintptr_t)addr | 1),
+                                               __ATOMIC_SEQ_CST,
+                                               __ATOMIC_SEQ_CST)) {
+        busy_woken++;
+        if (count != INT_MAX && --count == 0) {
+          return busy_woken;
+        }
       }
     }
   }
@@ -45,5 +51,5 @@ int emscripten_futex_wake(volatile void *addr, int count) {
   // Wake any workers waiting on this address.
   int ret = __builtin_wasm_memory_atomic_notify((int*)addr, count);
   assert(ret >= 0);
-  return ret + main_thread_woken;
+  return ret + busy_woken;
 }
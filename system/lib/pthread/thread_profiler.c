@@ -16,6 +16,17 @@ static bool enabled = false;
 
 #ifndef NDEBUG
 
+// Append a status transition to the thread's timeline, overwriting the oldest
+// one if the ring buffer is full. The reader in JS loads `eventCount` before
+// reading the events, so publish the event before bumping it.
+static void record_event(thread_profiler_block* block, double time, int status) {
+  uint32_t count = __c11_atomic_load(&block->eventCount, __ATOMIC_RELAXED);
+  thread_profiler_event* event = &block->events[count % EM_THREAD_PROFILER_EVENTS];
+  event->time = time;
+  event->status = status;
+  __c11_atomic_store(&block->eventCount, count + 1, __ATOMIC_RELEASE);
+}
+
 void _emscripten_thread_profiler_init(pthread_t thread) {
   assert(thread);
   if (!enabled) {
@@ -24,6 +35,9 @@ void _emscripten_thread_profiler_init(pthread_t thread) {
   thread->profilerBlock = emscripten_builtin_malloc(sizeof(thread_profiler_block));
   memset(thread->profilerBlock, 0, sizeof(thread_profiler_block));
   thread->profilerBlock->currentStatusStartTime = emscripten_get_now();
+  record_event(thread->profilerBlock,
+               thread->profilerBlock->currentStatusStartTime,
+               thread->profilerBlock->threadStatus);
 }
 
 // Sets the current thread status, but only if it was in the given expected
@@ -45,6 +59,7 @@ static void set_status_conditional(int expectedStatus, int newStatus) {
     thread->profilerBlock->timeSpentInStatus[prevStatus] += duration;
     thread->profilerBlock->threadStatus = newStatus;
     thread->profilerBlock->currentStatusStartTime = now;
+    record_event(thread->profilerBlock, now, newStatus);
   }
 }
 
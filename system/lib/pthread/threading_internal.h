@@ -8,6 +8,7 @@
 #pragma once
 
 #include <pthread.h>
+#include <stdint.h>
 
 #define EM_THREAD_NAME_MAX 32
 
@@ -21,6 +22,17 @@
 #define EM_THREAD_STATUS_FINISHED   6
 #define EM_THREAD_STATUS_NUMFIELDS  7
 
+// The number of most recent status transitions that each thread keeps for the
+// timeline of the thread profiler.
+#define EM_THREAD_PROFILER_EVENTS 1024
+
+typedef struct thread_profiler_event {
+  // Wallclock time at which the thread entered the status.
+  double time;
+  // One of THREAD_STATUS_*
+  int status;
+} thread_profiler_event;
+
 typedef struct thread_profiler_block {
   // One of THREAD_STATUS_*
   _Atomic int threadStatus;
@@ -31,6 +43,11 @@ typedef struct thread_profiler_block {
   double timeSpentInStatus[EM_THREAD_STATUS_NUMFIELDS];
   // A human-readable name for this thread.
   char name[EM_THREAD_NAME_MAX];
+  // Ring buffer of status transitions, written only by the thread itself and
+  // read from JS on the main thread. `eventCount` is the total number of
+  // events ever written; event `i` lives at `events[i % EM_THREAD_PROFILER_EVENTS]`.
+  _Atomic uint32_t eventCount;
+  thread_profiler_event events[EM_THREAD_PROFILER_EVENTS];
 } thread_profiler_block;
 
 // Called whenever a thread performs a blocking action (or calls sched_yield).
@@ -101,3 +118,16 @@ double _emscripten_receive_on_main_thread_js(int funcIndex, void* emAsmAddr, pth
 // if called from the main browser thread, this function will return zero
 // since blocking is not allowed there).
 int _emscripten_thread_supports_atomics_wait(void);
+
+// Threads that cannot use Atomics.wait (the main browser thread and audio
+// worklets) emulate futex waits by polling. While they do so they publish the
+// address they are waiting on in one of these slots, so that
+// emscripten_futex_wake can wake them without the value at the address
+// changing. A waker marks a slot as woken by setting the low bit of the
+// address in it; only the waiter that claimed a slot ever frees it again. See
+// emscripten_futex_wait.c.
+#define EM_FUTEX_BUSY_WAIT_SLOTS 16
+extern hidden _Atomic(void*) _emscripten_futex_busy_waiters[EM_FUTEX_BUSY_WAIT_SLOTS];
+// The number of claimed slots, which lets wakers skip scanning them in the
+// common case that nothing is polling.
+extern hidden _Atomic int _emscripten_futex_busy_waiter_count;
@@ -168,6 +168,16 @@ int emscripten_resize_heap(size_t size) {
   return 0;
 }
 
+#if defined(EMSCRIPTEN_PURE_WASI)
+// There are no JS heap views to keep up to date without JS.
+weak void emscripten_notify_memory_growth(size_t memory_index) {
+}
+
+weak uint32_t _emscripten_get_heap_view_refreshes() {
+  return 0;
+}
+#endif
+
 // Call clock_gettime with a particular clock and return the result in ms.
 static double clock_gettime_ms(clockid_t clock) {
   struct timespec ts;
@@ -0,0 +1,233 @@
+// Copyright 2024 The Emscripten Authors.  All rights reserved.
+// Emscripten is available under two separate licenses, the MIT license and the
+// University of Illinois/NCSA Open Source License.  Both these licenses can be
+// found in the LICENSE file.
+
+// Asynchronous file operations, see the comment in emscripten/wasmfs.h.
+//
+// Operations are put on a submission queue that a background thread drains in
+// order, performing each one with the normal synchronous API. Completions are
+// then posted back to the thread that submitted the operation, where the user
+// callback runs from the event loop. In builds without pthreads there is no
+// background thread; the operation is performed right away and only the
+// callback is deferred.
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <emscripten/emscripten.h>
+#include <emscripten/eventloop.h>
+#include <emscripten/promise.h>
+#include <emscripten/wasmfs.h>
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <pthread.h>
+
+#include <emscripten/proxying.h>
+#endif
+
+namespace {
+
+struct Request {
+  enum Kind { Open, Read, Write, Stat, Close };
+  Kind kind;
+  std::string path;
+  int flags = 0;
+  mode_t mode = 0;
+  int fd = -1;
+  void* buf = nullptr;
+  size_t len = 0;
+  off_t offset = 0;
+  wasmfs_async_callback_t callback;
+  void* userData;
+  ssize_t result = 0;
+#ifdef __EMSCRIPTEN_PTHREADS__
+  pthread_t caller;
+#endif
+
+  Request(Kind kind, wasmfs_async_callback_t callback, void* userData)
+    : kind(kind), callback(callback), userData(userData) {}
+};
+
+ssize_t perform(Request& req) {
+  ssize_t ret = 0;
+  switch (req.kind) {
+    case Request::Open:
+      ret = open(req.path.c_str(), req.flags, req.mode);
+      break;
+    case Request::Read:
+      ret = pread(req.fd, req.buf, req.len, req.offset);
+      break;
+    case Request::Write:
+      ret = pwrite(req.fd, req.buf, req.len, req.offset);
+      break;
+    case Request::Stat:
+      ret = stat(req.path.c_str(), (struct stat*)req.buf);
+      break;
+    case Request::Close:
+      ret = close(req.fd);
+      break;
+  }
+  return ret < 0 ? -errno : ret;
+}
+
+// Runs on the submitting thread.
+void complete(void* arg) {
+  auto* req = static_cast<Request*>(arg);
+  emscripten_runtime_keepalive_pop();
+  req->callback(req->userData, req->result);
+  delete req;
+}
+
+#ifdef __EMSCRIPTEN_PTHREADS__
+
+// The background thread exits after being idle for this long, so that it does
+// not keep the runtime alive, and is started again on the next submission.
+constexpr auto idleTimeout = std::chrono::seconds(1);
+
+std::mutex mutex;
+std::condition_variable cond;
+std::deque<Request*> submissions;
+bool running = false;
+
+void* run(void*) {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    if (!cond.wait_for(lock, idleTimeout, [] { return !submissions.empty(); })) {
+      running = false;
+      return nullptr;
+    }
+    auto* req = submissions.front();
+    submissions.pop_front();
+    lock.unlock();
+    req->result = perform(*req);
+    if (!emscripten_proxy_async(
+          emscripten_proxy_get_system_queue(), req->caller, complete, req)) {
+      // The submitting thread exited, so there is no one left to report the
+      // result to. Don't leak a file descriptor that it opened.
+      if (req->kind == Request::Open && req->result >= 0) {
+        close(req->result);
+      }
+      delete req;
+    }
+    lock.lock();
+  }
+}
+
+void submit(Request* req) {
+  emscripten_runtime_keepalive_push();
+  req->caller = pthread_self();
+  std::unique_lock<std::mutex> lock(mutex);
+  if (running) {
+    submissions.push_back(req);
+    cond.notify_one();
+    return;
+  }
+  // This does not wait for the thread to start, so it is safe to do on the
+  // main browser thread.
+  pthread_t thread;
+  int rc = pthread_create(&thread, nullptr, run, nullptr);
+  if (rc != 0) {
+    // Report the failure through the callback, which is still called
+    // asynchronously.
+    lock.unlock();
+    req->result = -rc;
+    emscripten_async_call(complete, req, 0);
+    return;
+  }
+  pthread_detach(thread);
+  submissions.push_back(req);
+  running = true;
+}
+
+#else
+
+void submit(Request* req) {
+  emscripten_runtime_keepalive_push();
+  req->result = perform(*req);
+  emscripten_async_call(complete, req, 0);
+}
+
+#endif
+
+} // anonymous namespace
+
+extern "C" {
+
+void wasmfs_async_open(const char* path,
+                       int flags,
+                       mode_t mode,
+                       wasmfs_async_callback_t callback,
+                       void* user_data) {
+  auto* req = new Request(Request::Open, callback, user_data);
+  req->path = path;
+  req->flags = flags;
+  req->mode = mode;
+  submit(req);
+}
+
+void wasmfs_async_read(int fd,
+                       void* buf,
+                       size_t len,
+                       off_t offset,
+                       wasmfs_async_callback_t callback,
+                       void* user_data) {
+  auto* req = new Request(Request::Read, callback, user_data);
+  req->fd = fd;
+  req->buf = buf;
+  req->len = len;
+  req->offset = offset;
+  submit(req);
+}
+
+void wasmfs_async_write(int fd,
+                        const void* buf,
+                        size_t len,
+                        off_t offset,
+                        wasmfs_async_callback_t callback,
+                        void* user_data) {
+  auto* req = new Request(Request::Write, callback, user_data);
+  req->fd = fd;
+  req->buf = const_cast<void*>(buf);
+  req->len = len;
+  req->offset = offset;
+  submit(req);
+}
+
+void wasmfs_async_stat(const char* path,
+                       struct stat* buf,
+                       wasmfs_async_callback_t callback,
+                       void* user_data) {
+  auto* req = new Request(Request::Stat, callback, user_data);
+  req->path = path;
+  req->buf = buf;
+  submit(req);
+}
+
+void wasmfs_async_close(int fd,
+                        wasmfs_async_callback_t callback,
+                        void* user_data) {
+  auto* req = new Request(Request::Close, callback, user_data);
+  req->fd = fd;
+  submit(req);
+}
+
+void wasmfs_async_resolve_promise(void* promise, ssize_t result) {
+  if (result < 0) {
+    emscripten_promise_resolve(
+      (em_promise_t)promise, EM_PROMISE_REJECT, (void*)-result);
+  } else {
+    emscripten_promise_resolve(
+      (em_promise_t)promise, EM_PROMISE_FULFILL, (void*)result);
+  }
+}
+
+} // extern "C"
@@ -17,31 +17,24 @@ class FetchFile : public ProxiedAsyncJSImplFile {
   std::string filePath;
 
 public:
-  FetchFile(const std::string& path,
-            mode_t mode,
-            backend_t backend,
-            emscripten::ProxyWorker& proxy)
-    : ProxiedAsyncJSImplFile(mode, backend, proxy), filePath(path) {}
+  FetchFile(const std::string& path, mode_t mode, backend_t backend)
+    : ProxiedAsyncJSImplFile(mode, backend), filePath(path) {}
 
   const std::string& getPath() const { return filePath; }
 };
 
 class FetchDirectory : public MemoryDirectory {
   std::string dirPath;
-  emscripten::ProxyWorker& proxy;
 
 public:
-  FetchDirectory(const std::string& path,
-                 mode_t mode,
-                 backend_t backend,
-                 emscripten::ProxyWorker& proxy)
-    : MemoryDirectory(mode, backend), dirPath(path), proxy(proxy) {}
+  FetchDirectory(const std::string& path, mode_t mode, backend_t backend)
+    : MemoryDirectory(mode, backend), dirPath(path) {}
 
   std::shared_ptr<DataFile> insertDataFile(const std::string& name,
                                            mode_t mode) override {
     auto childPath = getChildPath(name);
     auto child =
-      std::make_shared<FetchFile>(childPath, mode, getBackend(), proxy);
+      std::make_shared<FetchFile>(childPath, mode, getBackend());
     insertChild(name, child);
     return child;
   }
@@ -50,7 +43,7 @@ public:
                                              mode_t mode) override {
     auto childPath = getChildPath(name);
     auto childDir =
-      std::make_shared<FetchDirectory>(childPath, mode, getBackend(), proxy);
+      std::make_shared<FetchDirectory>(childPath, mode, getBackend());
     insertChild(name, childDir);
     return childDir;
   }
@@ -69,11 +62,11 @@ public:
     : ProxiedAsyncJSBackend(setupOnThread), baseUrl(baseUrl) {}
 
   std::shared_ptr<DataFile> createFile(mode_t mode) override {
-    return std::make_shared<FetchFile>(baseUrl, mode, this, proxy);
+    return std::make_shared<FetchFile>(baseUrl, mode, this);
   }
 
   std::shared_ptr<Directory> createDirectory(mode_t mode) override {
-    return std::make_shared<FetchDirectory>(baseUrl, mode, this, proxy);
+    return std::make_shared<FetchDirectory>(baseUrl, mode, this);
   }
 };
 
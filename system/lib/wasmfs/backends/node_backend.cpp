@@ -3,7 +3,10 @@
 // University of Illinois/NCSA Open Source License.  Both these licenses can be
 // found in the LICENSE file.
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <optional>
 
 #include "backend.h"
 #include "file.h"
@@ -15,6 +18,12 @@ namespace wasmfs {
 
 class NodeBackend;
 
+// Incremented whenever WasmFS modifies the underlying Node file system. Sizes
+// reported by a directory listing are only used if this has not changed since.
+// This is shared by all Node backends because several of them may be mounted on
+// the same Node directory.
+static std::atomic<uint32_t> modificationCount = 0;
+
 // The state of a file on the underlying Node file system.
 class NodeState {
   // Map all separate WasmFS opens of a file to a single underlying fd.
@@ -96,13 +105,25 @@ class NodeFile : public DataFile {
 public:
   NodeState state;
 
+  // The size reported by the directory listing this file was found in and the
+  // value of `modificationCount` at the time. It is used by the next `getSize`
+  // only, so that stat-ing each child after listing a directory does not take
+  // another call into JS per child.
+  std::optional<std::pair<off_t, uint32_t>> listedSize;
+
   NodeFile(mode_t mode, backend_t backend, std::string path)
     : DataFile(mode, backend), state(path) {}
 
 private:
   off_t getSize() override {
-    // TODO: This should really be using a 64-bit file size type.
-    uint32_t size;
+    if (listedSize) {
+      auto [size, count] = *listedSize;
+      listedSize.reset();
+      if (count == modificationCount && !state.isOpen()) {
+        return size;
+      }
+    }
+    off_t size;
     if (state.isOpen()) {
       if (_wasmfs_node_fstat_size(state.getFD(), &size)) {
         // TODO: Make this fallible.
@@ -114,19 +135,23 @@ private:
         return 0;
       }
     }
-    return off_t(size);
+    return size;
   }
 
   int setSize(off_t size) override {
     WASMFS_UNREACHABLE("TODO: implement NodeFile::setSize");
   }
 
-  int open(oflags_t flags) override { return state.open(flags); }
+  int open(oflags_t flags) override {
+    // Opening for writing may truncate the file.
+    ++modificationCount;
+    return state.open(flags);
+  }
 
   int close() override { return state.close(); }
 
   ssize_t read(uint8_t* buf, size_t len, off_t offset) override {
-    uint32_t nread;
+    size_t nread;
     if (auto err = _wasmfs_node_read(state.getFD(), buf, len, offset, &nread)) {
       return -err;
     }
@@ -134,7 +159,8 @@ private:
   }
 
   ssize_t write(const uint8_t* buf, size_t len, off_t offset) override {
-    uint32_t nwritten;
+    size_t nwritten;
+    ++modificationCount;
     if (auto err =
           _wasmfs_node_write(state.getFD(), buf, len, offset, &nwritten)) {
       return -err;
@@ -142,6 +168,29 @@ private:
     return nwritten;
   }
 
+  // Hand all the buffers to node at once rather than crossing into JS once per
+  // buffer.
+  ssize_t
+  readv(const __wasi_iovec_t* iovs, size_t iovsLen, off_t offset) override {
+    size_t nread;
+    if (auto err =
+          _wasmfs_node_readv(state.getFD(), iovs, iovsLen, offset, &nread)) {
+      return -err;
+    }
+    return nread;
+  }
+
+  ssize_t
+  writev(const __wasi_ciovec_t* iovs, size_t iovsLen, off_t offset) override {
+    size_t nwritten;
+    ++modificationCount;
+    if (auto err = _wasmfs_node_writev(
+          state.getFD(), iovs, iovsLen, offset, &nwritten)) {
+      return -err;
+    }
+    return nwritten;
+  }
+
   int flush() override {
     WASMFS_UNREACHABLE("TODO: implement NodeFile::flush");
   }
@@ -154,13 +203,74 @@ public:
   NodeDirectory(mode_t mode, backend_t backend, std::string path)
     : Directory(mode, backend), state(path) {}
 
+  // Remember the attributes of a child reported by
+  // `_wasmfs_node_readdir_attrs`, so that `getChild` can create its `File`
+  // later without another call into JS.
+  void recordListedChild(const std::string& name,
+                         mode_t mode,
+                         double size,
+                         double atime,
+                         double mtime,
+                         double ctime) {
+    if (S_ISREG(mode) || S_ISDIR(mode)) {
+      listed[name] = {
+        mode, off_t(size), atime, mtime, ctime, modificationCount};
+    }
+  }
+
+  // Whether the child is in the dcache already, in which case listing the
+  // directory does not need its attributes.
+  bool isChildCached(const std::string& name) { return isCached(name); }
+
 private:
+  // The attributes of the children from the last listing that have not been
+  // looked up yet, and the value of `modificationCount` at the time.
+  struct ListedChild {
+    mode_t mode;
+    off_t size;
+    double atime;
+    double mtime;
+    double ctime;
+    uint32_t modificationCount;
+  };
+  std::map<std::string, ListedChild> listed;
+
   std::string getChildPath(const std::string& name) {
     return state.path + '/' + name;
   }
 
+  std::shared_ptr<File> getListedChild(const std::string& name) {
+    auto it = listed.find(name);
+    if (it == listed.end()) {
+      return nullptr;
+    }
+    auto child = it->second;
+    listed.erase(it);
+    if (child.modificationCount != modificationCount) {
+      return nullptr;
+    }
+    auto childPath = getChildPath(name);
+    std::shared_ptr<File> file;
+    if (S_ISREG(child.mode)) {
+      auto dataFile =
+        std::make_shared<NodeFile>(child.mode, getBackend(), childPath);
+      dataFile->listedSize = {child.size, child.modificationCount};
+      file = dataFile;
+    } else {
+      file = std::make_shared<NodeDirectory>(child.mode, getBackend(), childPath);
+    }
+    auto lockedFile = file->locked();
+    lockedFile.setATime(child.atime);
+    lockedFile.setMTime(child.mtime);
+    lockedFile.setCTime(child.ctime);
+    return file;
+  }
+
   std::shared_ptr<File> getChild(const std::string& name) override {
     static_assert(std::is_same_v<mode_t, unsigned int>);
+    if (auto child = getListedChild(name)) {
+      return child;
+    }
     // TODO: also retrieve and set ctime, atime, ino, etc.
     auto childPath = getChildPath(name);
     mode_t mode;
@@ -182,6 +292,7 @@ private:
 
   int removeChild(const std::string& name) override {
     auto childPath = getChildPath(name);
+    ++modificationCount;
     // Try both `unlink` and `rmdir`.
     if (auto err = _wasmfs_node_unlink(childPath.c_str())) {
       if (err == EISDIR) {
@@ -195,6 +306,7 @@ private:
   std::shared_ptr<DataFile> insertDataFile(const std::string& name,
                                            mode_t mode) override {
     auto childPath = getChildPath(name);
+    ++modificationCount;
     if (_wasmfs_node_insert_file(childPath.c_str(), mode)) {
       return nullptr;
     }
@@ -204,6 +316,7 @@ private:
   std::shared_ptr<Directory> insertDirectory(const std::string& name,
                                              mode_t mode) override {
     auto childPath = getChildPath(name);
+    ++modificationCount;
     if (_wasmfs_node_insert_directory(childPath.c_str(), mode)) {
       return nullptr;
     }
@@ -238,6 +351,16 @@ private:
     }
     return {entries};
   }
+
+  Directory::MaybeEntries getEntriesWithAttributes() override {
+    std::vector<Directory::Entry> entries;
+    listed.clear();
+    int err = _wasmfs_node_readdir_attrs(state.path.c_str(), this, &entries);
+    if (err) {
+      return {-err};
+    }
+    return {entries};
+  }
 };
 
 class NodeBackend : public Backend {
@@ -274,6 +397,27 @@ void EMSCRIPTEN_KEEPALIVE _wasmfs_node_record_dirent(
   entries->push_back({name, File::FileKind(type), 0});
 }
 
+void EMSCRIPTEN_KEEPALIVE
+_wasmfs_node_record_dirent_attrs(std::vector<Directory::Entry>* entries,
+                                 NodeDirectory* dir,
+                                 const char* name,
+                                 mode_t mode,
+                                 double size,
+                                 double atime,
+                                 double mtime,
+                                 double ctime) {
+  dir->recordListedChild(name, mode, size, atime, mtime, ctime);
+  auto kind = S_ISREG(mode)   ? File::DataFileKind
+              : S_ISDIR(mode) ? File::DirectoryKind
+                              : File::UnknownKind;
+  entries->push_back({name, kind, 0});
+}
+
+int EMSCRIPTEN_KEEPALIVE _wasmfs_node_is_child_cached(NodeDirectory* dir,
+                                                      const char* name) {
+  return dir->isChildCached(name);
+}
+
 } // extern "C"
 
 } // namespace wasmfs
@@ -12,12 +12,18 @@ extern "C" {
 // Fill `entries` and return 0 or an error code.
 int _wasmfs_node_readdir(const char* path, void* entries
                          /* std::vector<Directory::Entry>*/);
+// Like `_wasmfs_node_readdir`, but also record the attributes of the regular
+// files and directories in `dir` that are not in its dcache yet.
+int _wasmfs_node_readdir_attrs(const char* path,
+                               void* dir /* NodeDirectory* */,
+                               void* entries
+                               /* std::vector<Directory::Entry>*/);
 // Write `mode` and return 0 or an error code.
 int _wasmfs_node_get_mode(const char* path, mode_t* mode);
 
 // Write `size` and return 0 or an error code.
-int _wasmfs_node_stat_size(const char* path, uint32_t* size);
-int _wasmfs_node_fstat_size(int fd, uint32_t* size);
+int _wasmfs_node_stat_size(const char* path, off_t* size);
+int _wasmfs_node_fstat_size(int fd, off_t* size);
 
 // Create a new file system entry and return 0 or an error code.
 int _wasmfs_node_insert_file(const char* path, mode_t mode);
@@ -36,10 +42,23 @@ int _wasmfs_node_rmdir(const char* path);
 // Read up to `size` bytes into `buf` from position `pos` in the file, writing
 // the number of bytes read to `nread`. Return 0 on success or an error code.
 int _wasmfs_node_read(
-  int fd, void* buf, uint32_t len, uint32_t pos, uint32_t* nread);
+  int fd, void* buf, size_t len, off_t pos, size_t* nread);
 
 // Write up to `size` bytes from `buf` at position `pos` in the file, writing
 // the number of bytes written to `nread`. Return 0 on success or an error code.
 int _wasmfs_node_write(
-  int fd, const void* buf, uint32_t len, uint32_t pos, uint32_t* nwritten);
+  int fd, const void* buf, size_t len, off_t pos, size_t* nwritten);
+
+// Like `_wasmfs_node_read` and `_wasmfs_node_write`, but scatter or gather the
+// data directly from or to all of the `iovcnt` buffers in `iovs` at once.
+int _wasmfs_node_readv(int fd,
+                       const void* iovs /* __wasi_iovec_t* */,
+                       size_t iovcnt,
+                       off_t pos,
+                       size_t* nread);
+int _wasmfs_node_writev(int fd,
+                        const void* iovs /* __wasi_ciovec_t* */,
+                        size_t iovcnt,
+                        off_t pos,
+                        size_t* nwritten);
 }
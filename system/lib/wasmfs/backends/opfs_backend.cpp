@@ -3,7 +3,10 @@
 // University of Illinois/NCSA Open Source License.  Both these licenses can be
 // found in the LICENSE file.
 
+#include <atomic>
 #include <emscripten/threading.h>
+#include <map>
+#include <optional>
 #include <stdlib.h>
 
 #include "backend.h"
@@ -23,7 +26,9 @@ using ProxyingQueue = emscripten::ProxyingQueue;
 class Worker {
 public:
 #ifdef __EMSCRIPTEN_PTHREADS__
-  ProxyWorker proxy;
+  // The whole backend uses a single worker from the shared pool, as the IDs of
+  // the OPFS handles index into JS tables that are local to that thread.
+  ProxyWorker& proxy = emscripten::ProxyWorkerPool::get().acquire();
 
   template<typename T> void operator()(T func) { proxy(func); }
 #else
@@ -134,12 +139,22 @@ public:
   }
 };
 
+// Incremented whenever WasmFS modifies OPFS. Sizes reported by a directory
+// listing are only used if this has not changed since.
+static std::atomic<uint32_t> modificationCount = 0;
+
 class OPFSFile : public DataFile {
 public:
   Worker& proxy;
   int fileID;
   OpenState state;
 
+  // The size reported by the directory listing this file was found in and the
+  // value of `modificationCount` at the time. It is used by the next `getSize`
+  // only, so that stat-ing each child after listing a directory does not take
+  // another proxied call per child.
+  std::optional<std::pair<off_t, uint32_t>> listedSize;
+
   OPFSFile(mode_t mode, backend_t backend, int fileID, Worker& proxy)
     : DataFile(mode, backend), proxy(proxy), fileID(fileID) {}
 
@@ -150,6 +165,13 @@ public:
 
 private:
   off_t getSize() override {
+    if (listedSize) {
+      auto [size, count] = *listedSize;
+      listedSize.reset();
+      if (count == modificationCount && state.getKind() == OpenState::None) {
+        return size;
+      }
+    }
     off_t size;
     switch (state.getKind()) {
       case OpenState::None:
@@ -173,6 +195,7 @@ private:
 
   int setSize(off_t size) override {
     int err = 0;
+    ++modificationCount;
     switch (state.getKind()) {
       case OpenState::Access:
         proxy([&](auto ctx) {
@@ -231,6 +254,7 @@ private:
     assert(state.getKind() == OpenState::Access);
     // TODO: use an i64 here.
     int32_t nwritten;
+    ++modificationCount;
     proxy([&]() {
       nwritten =
         _wasmfs_opfs_write_access(state.getAccessID(), buf, len, offset);
@@ -266,14 +290,88 @@ public:
     : Directory(mode, backend), proxy(proxy), dirID(dirID) {}
 
   ~OPFSDirectory() override {
-    // Never free the root directory ID.
-    if (dirID != 0) {
-      proxy([&]() { _wasmfs_opfs_free_directory(dirID); });
-    }
+    proxy([&]() {
+      freeListedChildren();
+      // Never free the root directory ID.
+      if (dirID != 0) {
+        _wasmfs_opfs_free_directory(dirID);
+      }
+    });
+  }
+
+  // Remember a child reported by `_wasmfs_opfs_get_entries_attrs`, so that
+  // `getChild` can create its `File` later without another proxied call.
+  void recordListedChild(const std::string& name,
+                         int childType,
+                         int childID,
+                         double size,
+                         double mtime) {
+    listed[name] = {childType, childID, off_t(size), mtime, modificationCount};
   }
 
+  // Whether the child is in the dcache already, in which case listing the
+  // directory does not need its attributes.
+  bool isChildCached(const std::string& name) { return isCached(name); }
+
 private:
+  // The children from the last listing that have not been looked up yet, with
+  // the handle IDs allocated for them and the value of `modificationCount` at
+  // the time.
+  struct ListedChild {
+    int type;
+    int id;
+    off_t size;
+    double mtime;
+    uint32_t modificationCount;
+  };
+  std::map<std::string, ListedChild> listed;
+
+  // Free the handle IDs of the listed children. Must be called on the worker.
+  void freeListedChildren() {
+    for (auto& [name, child] : listed) {
+      if (child.type == 1) {
+        _wasmfs_opfs_free_file(child.id);
+      } else {
+        _wasmfs_opfs_free_directory(child.id);
+      }
+    }
+    listed.clear();
+  }
+
+  std::shared_ptr<File> getListedChild(const std::string& name) {
+    auto it = listed.find(name);
+    if (it == listed.end()) {
+      return nullptr;
+    }
+    auto child = it->second;
+    listed.erase(it);
+    if (child.modificationCount != modificationCount) {
+      // The handle may be for a file that has been replaced since.
+      proxy([&]() {
+        if (child.type == 1) {
+          _wasmfs_opfs_free_file(child.id);
+        } else {
+          _wasmfs_opfs_free_directory(child.id);
+        }
+      });
+      return nullptr;
+    }
+    if (child.type == 1) {
+      auto file = std::make_shared<OPFSFile>(0777, getBackend(), child.id, proxy);
+      file->listedSize = {child.size, child.modificationCount};
+      auto lockedFile = file->locked();
+      lockedFile.setMTime(child.mtime);
+      lockedFile.setCTime(child.mtime);
+      return file;
+    }
+    // OPFS does not track times for directories.
+    return std::make_shared<OPFSDirectory>(0777, getBackend(), child.id, proxy);
+  }
+
   std::shared_ptr<File> getChild(const std::string& name) override {
+    if (auto child = getListedChild(name)) {
+      return child;
+    }
     int childType = 0, childID = 0;
     proxy([&](auto ctx) {
       _wasmfs_opfs_get_child(
@@ -296,6 +394,7 @@ private:
   std::shared_ptr<DataFile> insertDataFile(const std::string& name,
                                            mode_t mode) override {
     int childID = 0;
+    ++modificationCount;
     proxy([&](auto ctx) {
       _wasmfs_opfs_insert_file(ctx.ctx, dirID, name.c_str(), &childID);
     });
@@ -309,6 +408,7 @@ private:
   std::shared_ptr<Directory> insertDirectory(const std::string& name,
                                              mode_t mode) override {
     int childID = 0;
+    ++modificationCount;
     proxy([&](auto ctx) {
       _wasmfs_opfs_insert_directory(ctx.ctx, dirID, name.c_str(), &childID);
     });
@@ -328,6 +428,7 @@ private:
 
   int insertMove(const std::string& name, std::shared_ptr<File> file) override {
     int err = 0;
+    ++modificationCount;
     if (file->is<DataFile>()) {
       auto opfsFile = std::static_pointer_cast<OPFSFile>(file);
       proxy([&](auto ctx) {
@@ -345,6 +446,7 @@ private:
 
   int removeChild(const std::string& name) override {
     int err = 0;
+    ++modificationCount;
     proxy([&](auto ctx) {
       _wasmfs_opfs_remove_child(ctx.ctx, dirID, name.c_str(), &err);
     });
@@ -371,6 +473,20 @@ private:
     }
     return {entries};
   }
+
+  Directory::MaybeEntries getEntriesWithAttributes() override {
+    std::vector<Directory::Entry> entries;
+    int err = 0;
+    proxy([&](auto ctx) {
+      freeListedChildren();
+      _wasmfs_opfs_get_entries_attrs(ctx.ctx, dirID, this, &entries, &err);
+    });
+    if (err) {
+      assert(err < 0);
+      return {err};
+    }
+    return {entries};
+  }
 };
 
 class OPFSBackend : public Backend {
@@ -415,4 +531,22 @@ void EMSCRIPTEN_KEEPALIVE _wasmfs_opfs_record_entry(
   entries->push_back({name, File::FileKind(type), 0});
 }
 
+void EMSCRIPTEN_KEEPALIVE
+_wasmfs_opfs_record_entry_attrs(std::vector<Directory::Entry>* entries,
+                                OPFSDirectory* dir,
+                                const char* name,
+                                int child_type,
+                                int child_id,
+                                double size,
+                                double mtime) {
+  dir->recordListedChild(name, child_type, child_id, size, mtime);
+  entries->push_back(
+    {name, child_type == 1 ? File::DataFileKind : File::DirectoryKind, 0});
+}
+
+int EMSCRIPTEN_KEEPALIVE _wasmfs_opfs_is_child_cached(OPFSDirectory* dir,
+                                                      const char* name) {
+  return dir->isChildCached(name);
+}
+
 } // extern "C"
@@ -49,6 +49,14 @@ void _wasmfs_opfs_get_entries(em_proxying_ctx* ctx,
                               std::vector<Directory::Entry>* entries,
                               int* err);
 
+// Like `_wasmfs_opfs_get_entries`, but also open each child that is not in the
+// dcache of `dir` yet and record its handle, size and modification time there.
+void _wasmfs_opfs_get_entries_attrs(em_proxying_ctx* ctx,
+                                    int dirID,
+                                    void* dir /* OPFSDirectory* */,
+                                    std::vector<Directory::Entry>* entries,
+                                    int* err);
+
 void _wasmfs_opfs_open_access(em_proxying_ctx* ctx,
                               int file_id,
                               int* access_id);
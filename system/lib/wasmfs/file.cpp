@@ -17,6 +17,48 @@ namespace wasmfs {
 // DataFile
 //
 
+ssize_t
+DataFile::readv(const __wasi_iovec_t* iovs, size_t iovsLen, off_t offset) {
+  size_t bytesRead = 0;
+  for (size_t i = 0; i < iovsLen; i++) {
+    size_t len = iovs[i].buf_len;
+    auto result = read(iovs[i].buf, len, offset + bytesRead);
+    if (result < 0) {
+      // This individual read failed. Report the error unless we've already read
+      // some bytes, in which case report a successful short read.
+      return bytesRead > 0 ? bytesRead : result;
+    }
+    // Backends must only return len or less.
+    assert(result <= len);
+    bytesRead += result;
+    if (result < len) {
+      // The read was short, so stop here.
+      break;
+    }
+  }
+  return bytesRead;
+}
+
+ssize_t
+DataFile::writev(const __wasi_ciovec_t* iovs, size_t iovsLen, off_t offset) {
+  size_t bytesWritten = 0;
+  for (size_t i = 0; i < iovsLen; i++) {
+    size_t len = iovs[i].buf_len;
+    auto result = write(iovs[i].buf, len, offset + bytesWritten);
+    if (result < 0) {
+      // This individual write failed. Report the error unless we've already
+      // written some bytes, in which case report a successful short write.
+      return bytesWritten > 0 ? bytesWritten : result;
+    }
+    bytesWritten += result;
+    if (result < len) {
+      // The write was short, so stop here.
+      break;
+    }
+  }
+  return bytesWritten;
+}
+
 void DataFile::Handle::preloadFromJS(int index) {
   // TODO: Each Datafile type could have its own impl of file preloading.
   // Create a buffer with the required file size.
@@ -236,11 +278,22 @@ ssize_t Directory::Handle::getNumEntries() {
 }
 
 Directory::MaybeEntries Directory::Handle::getEntries() {
-  auto entries = getDir()->getEntries();
+  // Backends that maintain file identity themselves do not use the dcache, so
+  // there is nowhere to keep the children of a bulk listing.
+  auto entries = getDir()->maintainsFileIdentity()
+                   ? getDir()->getEntries()
+                   : getDir()->getEntriesWithAttributes();
   if (entries.getError()) {
     return entries;
   }
   auto& dcache = getDir()->dcache;
+  for (auto& entry : *entries) {
+    // Children that have not been looked up yet have no `File`, and so no
+    // inode number, until they are.
+    if (auto it = dcache.find(entry.name); it != dcache.end()) {
+      entry.ino = it->second.file->getIno();
+    }
+  }
   for (auto it = dcache.begin(); it != dcache.end(); ++it) {
     auto& [name, entry] = *it;
     if (entry.kind == DCacheKind::Mount) {
@@ -144,6 +144,17 @@ protected:
   virtual ssize_t read(uint8_t* buf, size_t len, off_t offset) = 0;
   virtual ssize_t write(const uint8_t* buf, size_t len, off_t offset) = 0;
 
+  // Access each of the buffers in turn, starting at `offset`, and return the
+  // total accessed length or a negative error code. As with `read` and
+  // `write`, a short count means that the remaining buffers were not
+  // accessed. By default this calls `read` or `write` once per buffer, which
+  // backends for which each call is expensive can override to access all the
+  // buffers at once.
+  virtual ssize_t
+  readv(const __wasi_iovec_t* iovs, size_t iovsLen, off_t offset);
+  virtual ssize_t
+  writev(const __wasi_ciovec_t* iovs, size_t iovsLen, off_t offset);
+
   // Sets the size of the file to a specific size. If new space is allocated, it
   // should be zero-initialized. May be called on files that have not been
   // opened. Returns 0 on success or a negative error code.
@@ -240,6 +251,18 @@ protected:
   // The list of entries in this directory or a negative error code.
   virtual MaybeEntries getEntries() = 0;
 
+  // Like `getEntries`, but also remember the mode, size, and times of the
+  // children that are not in the dcache yet (see `isCached`). Backends that can
+  // query the attributes of all children in a single call (for example a single
+  // proxied call) should override this, and create the `File` of a listed child
+  // from what they remembered when `getChild` is called for it. Looking up and
+  // stat-ing the children after listing the directory then does not need
+  // another call into the backend per child.
+  virtual MaybeEntries getEntriesWithAttributes() { return getEntries(); }
+
+  // Whether the child with the given name is in the dcache.
+  bool isCached(const std::string& name) { return dcache.count(name); }
+
   // Only backends that maintain file identity themselves (see below) need to
   // implement this.
   virtual std::string getName(std::shared_ptr<File> file) {
@@ -365,6 +388,13 @@ public:
     return getFile()->write(buf, len, offset);
   }
 
+  ssize_t readv(const __wasi_iovec_t* iovs, size_t iovsLen, off_t offset) {
+    return getFile()->readv(iovs, iovsLen, offset);
+  }
+  ssize_t writev(const __wasi_ciovec_t* iovs, size_t iovsLen, off_t offset) {
+    return getFile()->writev(iovs, iovsLen, offset);
+  }
+
   [[nodiscard]] int setSize(off_t size) { return getFile()->setSize(size); }
 
   // TODO: Design a proper API for flushing files.
@@ -71,7 +71,11 @@ void _wasmfs_jsimpl_async_get_size(em_proxying_ctx* ctx,
 
 namespace wasmfs {
 
+class ProxiedAsyncJSBackend;
+
 class ProxiedAsyncJSImplFile : public DataFile {
+  // The worker this file is bound to. All of the file's operations are proxied
+  // to it, as that is where the JS side keeps the state for the file.
   emscripten::ProxyWorker& proxy;
 
   js_index_t getBackendIndex() {
@@ -122,15 +126,7 @@ class ProxiedAsyncJSImplFile : public DataFile {
   }
 
 public:
-  ProxiedAsyncJSImplFile(mode_t mode,
-                         backend_t backend,
-                         emscripten::ProxyWorker& proxy)
-    : DataFile(mode, backend), proxy(proxy) {
-    proxy([&](auto ctx) {
-      _wasmfs_jsimpl_async_alloc_file(
-        ctx.ctx, getBackendIndex(), getFileIndex());
-    });
-  }
+  ProxiedAsyncJSImplFile(mode_t mode, backend_t backend);
 
   ~ProxiedAsyncJSImplFile() {
     proxy([&](auto ctx) {
@@ -141,21 +137,40 @@ public:
 };
 
 class ProxiedAsyncJSBackend : public Backend {
-protected:
-  emscripten::ProxyWorker proxy;
+  std::function<void(backend_t)> setupOnThread;
+
+  // The workers of the shared pool on which setupOnThread has been run.
+  std::mutex mutex;
+  std::vector<emscripten::ProxyWorker*> workers;
 
 public:
   // Receives as a parameter a function to call on the proxied thread, which is
-  // useful for doing setup there.
-  ProxiedAsyncJSBackend(std::function<void(backend_t)> setupOnThread) {
-    proxy([&](auto ctx) {
-      setupOnThread(this);
-      ctx.finish();
-    });
+  // useful for doing setup there. It is called once on each worker that ends
+  // up serving files of this backend.
+  ProxiedAsyncJSBackend(std::function<void(backend_t)> setupOnThread)
+    : setupOnThread(setupOnThread) {
+    // Set up on a first worker now. This may run on the main browser thread,
+    // in which case the pool only hands out existing workers, and spawning the
+    // very first one there asserts in ProxyWorker.
+    getWorker();
+  }
+
+  // Get a worker from the shared pool to bind a new file to.
+  emscripten::ProxyWorker& getWorker() {
+    auto& worker = emscripten::ProxyWorkerPool::get().acquire();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (std::find(workers.begin(), workers.end(), &worker) == workers.end()) {
+      worker([&](auto ctx) {
+        setupOnThread(this);
+        ctx.finish();
+      });
+      workers.push_back(&worker);
+    }
+    return worker;
   }
 
   std::shared_ptr<DataFile> createFile(mode_t mode) override {
-    return std::make_shared<ProxiedAsyncJSImplFile>(mode, this, proxy);
+    return std::make_shared<ProxiedAsyncJSImplFile>(mode, this);
   }
 
   std::shared_ptr<Directory> createDirectory(mode_t mode) override {
@@ -167,4 +182,13 @@ public:
   }
 };
 
+inline ProxiedAsyncJSImplFile::ProxiedAsyncJSImplFile(mode_t mode,
+                                                      backend_t backend)
+  : DataFile(mode, backend),
+    proxy(static_cast<ProxiedAsyncJSBackend*>(backend)->getWorker()) {
+  proxy([&](auto ctx) {
+    _wasmfs_jsimpl_async_alloc_file(ctx.ctx, getBackendIndex(), getFileIndex());
+  });
+}
+
 } // namespace wasmfs
@@ -131,38 +131,26 @@ static __wasi_errno_t writeAtOffset(OffsetHandling setOffset,
 
   // TODO: Check open file access mode for write permissions.
 
-  size_t bytesWritten = 0;
+  __wasi_filesize_t totalLen = 0;
   for (size_t i = 0; i < iovs_len; i++) {
-    const uint8_t* buf = iovs[i].buf;
-    off_t len = iovs[i].buf_len;
-
     // Check if buf_len specifies a positive length buffer but buf is a
     // null pointer
-    if (!buf && len > 0) {
+    if (!iovs[i].buf && iovs[i].buf_len > 0) {
       return __WASI_ERRNO_INVAL;
     }
 
     // Check if the sum of the buf_len values overflows an off_t (63 bits).
-    if (addWillOverFlow(offset, (__wasi_filesize_t)bytesWritten)) {
+    if (addWillOverFlow(offset, totalLen)) {
       return __WASI_ERRNO_FBIG;
     }
+    totalLen += iovs[i].buf_len;
+  }
 
-    auto result = lockedFile.write(buf, len, offset + bytesWritten);
-    if (result < 0) {
-      // This individual write failed. Report the error unless we've already
-      // written some bytes, in which case report a successful short write.
-      if (bytesWritten > 0) {
-        break;
-      }
-      return -result;
-    }
-    // The write was successful.
-    bytesWritten += result;
-    if (result < len) {
-      // The write was short, so stop here.
-      break;
-    }
+  auto result = lockedFile.writev(iovs, iovs_len, offset);
+  if (result < 0) {
+    return -result;
   }
+  size_t bytesWritten = result;
   *nwritten = bytesWritten;
   if (setOffset == OffsetHandling::OpenFileState &&
       lockedOpenFile.getFile()->isSeekable()) {
@@ -210,37 +198,18 @@ static __wasi_errno_t readAtOffset(OffsetHandling setOffset,
 
   auto lockedFile = file->locked();
 
-  size_t bytesRead = 0;
   for (size_t i = 0; i < iovs_len; i++) {
-    uint8_t* buf = iovs[i].buf;
-    size_t len = iovs[i].buf_len;
-
-    if (!buf && len > 0) {
+    if (!iovs[i].buf && iovs[i].buf_len > 0) {
       return __WASI_ERRNO_INVAL;
     }
+  }
 
-    // TODO: Check for overflow when adding offset + bytesRead.
-    auto result = lockedFile.read(buf, len, offset + bytesRead);
-    if (result < 0) {
-      // This individual read failed. Report the error unless we've already read
-      // some bytes, in which case report a successful short read.
-      if (bytesRead > 0) {
-        break;
-      }
-      return -result;
-    }
-
-    // The read was successful.
-
-    // Backends must only return len or less.
-    assert(result <= len);
-
-    bytesRead += result;
-    if (result < len) {
-      // The read was short, so stop here.
-      break;
-    }
+  // TODO: Check for overflow when adding offset + bytesRead.
+  auto result = lockedFile.readv(iovs, iovs_len, offset);
+  if (result < 0) {
+    return -result;
   }
+  size_t bytesRead = result;
   *nread = bytesRead;
   if (setOffset == OffsetHandling::OpenFileState &&
       lockedOpenFile.getFile()->isSeekable()) {
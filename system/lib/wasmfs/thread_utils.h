@@ -7,14 +7,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include <emscripten/proxying.h>
 #include <emscripten/threading.h>
 
 extern "C" {
 void _wasmfs_thread_utils_heartbeat(em_proxying_queue* ctx);
+int _wasmfs_get_io_thread_count(void);
 }
 
 namespace emscripten {
@@ -98,4 +103,44 @@ public:
   }
 };
 
+// A bounded set of ProxyWorkers that is shared by all the backends that need to
+// run (possibly asynchronous) JS on a worker thread, so that the number of
+// threads does not grow with the number of mounts. The size is set with
+// -sWASMFS_IO_THREADS.
+//
+// Users bind each of their files to one worker, which keeps the operations on a
+// file in order (they are already serialized by the file lock) while different
+// files, even on the same backend, can be serviced by different threads.
+class ProxyWorkerPool {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ProxyWorker>> workers;
+  size_t maxWorkers;
+  size_t next = 0;
+
+public:
+  ProxyWorkerPool(size_t maxWorkers)
+    : maxWorkers(std::max<size_t>(maxWorkers, 1)) {}
+
+  static ProxyWorkerPool& get() {
+    // Never destroyed, as files may still be bound to the workers during
+    // shutdown.
+    static ProxyWorkerPool* pool =
+      new ProxyWorkerPool(_wasmfs_get_io_thread_count());
+    return *pool;
+  }
+
+  // Pick a worker, round robin. Workers are spawned lazily up to the limit, but
+  // since that is not safe on the main browser thread (see ProxyWorker), calls
+  // from there only reuse the existing workers.
+  ProxyWorker& acquire() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (workers.size() < maxWorkers &&
+        (workers.empty() || !emscripten_is_main_browser_thread())) {
+      workers.push_back(std::make_unique<ProxyWorker>());
+      return *workers.back();
+    }
+    return *workers[next++ % workers.size()];
+  }
+};
+
 } // namespace emscripten
@@ -33,12 +33,12 @@ native_info = Popen(['clang', '-v'], stdout=PIPE, stderr=PIPE).communicate()
 emscripten_info = Popen([EMCC, '-v'], stdout=PIPE, stderr=PIPE).communicate()
 
 
-def run_benchmark(benchmark_file, results_file, build_args):
+def run_benchmark(benchmark_file, results_file, build_args, native_args=[]):
     # Run native build
     out_file = os.path.join(temp_dir, 'benchmark_sse_native')
     if WINDOWS:
         out_file += '.exe'
-    cmd = [CLANG_CXX] + clang_native.get_clang_native_args() + [benchmark_file, '-O3', '-o', out_file]
+    cmd = [CLANG_CXX] + clang_native.get_clang_native_args() + [benchmark_file, '-O3', '-o', out_file] + native_args
     print('Building native version of the benchmark:')
     print(' '.join(cmd))
     run_process(cmd, env=clang_native.get_clang_native_env())
@@ -48,7 +48,7 @@ def run_benchmark(benchmark_file, results_file, build_args):
 
     # Run emscripten build
     out_file = os.path.join(temp_dir, 'benchmark_sse_html.js')
-    cmd = [EMCC, benchmark_file, '-O3', '-sTOTAL_MEMORY=536870912', '-o', out_file] + build_args
+    cmd = [EMCC, benchmark_file, '-O3', '-sTOTAL_MEMORY=536870912', '-msimd128', '-o', out_file] + build_args
     print('Building Emscripten version of the benchmark:')
     print(' '.join(cmd))
     run_process(cmd)
@@ -301,5 +301,9 @@ if __name__ == '__main__':
         run_benchmark(test_file('sse/benchmark_sse3.cpp'), 'results_sse3.html', ['-msse3'])
     elif suite == 'ssse3':
         run_benchmark(test_file('sse/benchmark_ssse3.cpp'), 'results_ssse3.html', ['-mssse3'])
+    elif suite == 'avx':
+        run_benchmark(test_file('sse/benchmark_avx.cpp'), 'results_avx.html', ['-mavx'], ['-mavx'])
+    elif suite == 'avx2':
+        run_benchmark(test_file('sse/benchmark_avx2.cpp'), 'results_avx2.html', ['-mavx2'], ['-mavx2'])
     else:
-        raise Exception('Usage: python test/benchmark_sse.py sse1|sse2|sse3')
+        raise Exception('Usage: python test/benchmark_sse.py sse1|sse2|sse3|ssse3|avx|avx2')
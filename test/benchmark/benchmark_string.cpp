@@ -0,0 +1,102 @@
+// Copyright 2024 The Emscripten Authors.  All rights reserved.
+// Emscripten is available under two separate licenses, the MIT license and the
+// University of Illinois/NCSA Open Source License.  Both these licenses can be
+// found in the LICENSE file.
+
+// Benchmarks the string scanning and comparison routines from libc over a
+// range of string lengths.  Build with and without -msimd128 to compare the
+// SIMD and scalar versions.
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <iostream>
+
+#include "tick.h"
+
+#ifndef MIN_SIZE
+#define MIN_SIZE 1
+#endif
+
+#ifndef MAX_SIZE
+#define MAX_SIZE 1024*1024
+#endif
+
+#ifndef NUM_TRIALS
+#define NUM_TRIALS 5
+#endif
+
+char a[MAX_SIZE+32] = {};
+char b[MAX_SIZE+32] = {};
+
+size_t resultCheckSum = 0;
+double totalTimeSecs = 0.0;
+
+// Each routine is run over `size` bytes, with the interesting byte (the
+// terminator, the needle or the first difference) at the end, so that the
+// whole string is scanned.
+enum Func { STRLEN, MEMCHR, STRCHR, MEMCMP, STRCMP, STRSPN, STRCSPN, NUM_FUNCS };
+const char *funcNames[NUM_FUNCS] = { "strlen", "memchr", "strchr", "memcmp", "strcmp", "strspn", "strcspn" };
+
+void __attribute__((noinline)) run(Func func, int numTimes, int size)
+{
+	for(int i = 0; i < numTimes; ++i)
+	{
+		// Vary the alignment between iterations.
+		int off = i & 15;
+		switch(func)
+		{
+		case STRLEN: resultCheckSum += strlen(a + off); break;
+		case MEMCHR: resultCheckSum += (size_t)memchr(a + off, 'x', size); break;
+		case STRCHR: resultCheckSum += (size_t)strchr(a + off, 'x'); break;
+		case MEMCMP: resultCheckSum += memcmp(a + off, b + off, size); break;
+		case STRCMP: resultCheckSum += strcmp(a + off, b + off); break;
+		case STRSPN: resultCheckSum += strspn(a + off, "abc"); break;
+		case STRCSPN: resultCheckSum += strcspn(a + off, "xyz"); break;
+		default: break;
+		}
+	}
+}
+
+void test_case(Func func, int size)
+{
+	// Strings are `size` bytes long starting at any offset in [0, 16).
+	memset(a, 'a', sizeof(a));
+	memset(b, 'a', sizeof(b));
+	a[size] = 'x';
+	a[size + 16] = 0;
+	b[size + 16] = 0;
+
+	const int minimumBytes = 1024*1024*64;
+	int numTimes = (minimumBytes + size - 1) / size;
+	if (numTimes < 16) numTimes = 16;
+
+	tick_t bestResult = 1e9;
+	for(int i = 0; i < NUM_TRIALS; ++i)
+	{
+		tick_t t0 = tick();
+		run(func, numTimes, size);
+		tick_t t1 = tick();
+		if (t1 - t0 < bestResult) bestResult = t1 - t0;
+		totalTimeSecs += (double)(t1 - t0) / ticks_per_sec();
+	}
+
+	double mbytesPerSecond = 0.0;
+	if (bestResult > 0)
+	{
+		double seconds = (double)bestResult / ticks_per_sec();
+		mbytesPerSecond = (double)numTimes * size / seconds / (1024.0*1024.0);
+	}
+	std::cout << funcNames[func] << " " << size << ": " << mbytesPerSecond << " MB/s" << std::endl;
+}
+
+int main()
+{
+	for(int f = 0; f < NUM_FUNCS; ++f)
+		for(int size = MIN_SIZE; size <= MAX_SIZE; size <<= 2)
+			test_case((Func)f, size);
+
+	std::cout << "Result checksum: " << (int)(resultCheckSum & 0xff) << std::endl;
+	std::cout << "Total time: " << totalTimeSecs << std::endl;
+}
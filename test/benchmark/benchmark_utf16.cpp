@@ -64,6 +64,15 @@ int main() {
     delete [] str;
   }
   double t3 = emscripten_get_now();
-  printf("OK. Time: %f (%f).\n", t, t3-t2);
+
+  // Long strings, whose terminator is found with a SIMD scan in wasm when
+  // linking with -msimd128.
+  double tLong = 0;
+  for(int i = 0; i < 100; ++i) {
+    unsigned short *str = randomString(1000 + i * 20);
+    tLong += test(str);
+    delete [] str;
+  }
+  printf("OK. Time: %f (%f). Long strings: %f.\n", t, t3-t2, tLong);
   return 0;
 }
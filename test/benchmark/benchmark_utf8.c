@@ -10,7 +10,7 @@
 #include <emscripten.h>
 #include <time.h>
 
-EM_JS_DEPS(deps, "$UTF8ToString,emscripten_get_now");
+EM_JS_DEPS(deps, "$UTF8ToString,$stringToUTF8,emscripten_get_now");
 
 double test(const char *str) {
   double res = EM_ASM_DOUBLE({
@@ -23,6 +23,20 @@ double test(const char *str) {
   return res;
 }
 
+// Decodes `str` and encodes the result back into `out`, and returns the time
+// spent encoding.
+double test_encode(const char *str, char *out, int outSize) {
+  double res = EM_ASM_DOUBLE({
+    var str = UTF8ToString($0);
+    var t0 = _emscripten_get_now();
+    stringToUTF8(str, $1, $2);
+    var t1 = _emscripten_get_now();
+    return (t1-t0);
+  }, str, out, outSize);
+  assert(!strcmp(str, out));
+  return res;
+}
+
 char *utf8_corpus = 0;
 long utf8_corpus_length = 0;
 
@@ -68,6 +82,18 @@ int main() {
     free(str);
   }
   double t3 = emscripten_get_now();
-  printf("OK. Time: %f (%f).\n", t, t3-t2);
+
+  // Long strings, which are decoded with TextDecoder or, when linking with
+  // -msimd128, scanned and transcoded in wasm.
+  double tLong = 0, tEncode = 0;
+  char *out = malloc(8192+1);
+  for (int i = 0; i < 200; ++i) {
+    char *str = randomString(1024 + (i * 317) % 7168);
+    tLong += test(str);
+    tEncode += test_encode(str, out, 8192+1);
+    free(str);
+  }
+  free(out);
+  printf("OK. Time: %f (%f). Long strings: %f. Encoding: %f.\n", t, t3-t2, tLong, tEncode);
   return 0;
 }
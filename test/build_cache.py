@@ -0,0 +1,268 @@
+# Copyright 2024 The Emscripten Authors.  All rights reserved.
+# Emscripten is available under two separate licenses, the MIT license and the
+# University of Illinois/NCSA Open Source License.  Both these licenses can be
+# found in the LICENSE file.
+
+"""A content-addressed cache of test build outputs, shared between test workers.
+
+When EMTEST_BUILD_CACHE names a directory, RunnerCore.build looks each
+compile+link command up in it before running emcc.  The key covers:
+
+ - the command line, with the test's working directory abstracted away,
+ - the contents of every file or directory named on the command line,
+ - the EMCC_* and EM_* environment, and
+ - a fingerprint of the emscripten tree and the compiler binaries.
+
+Each entry also records the sources and headers that the build read (as
+reported by `emcc -M`) together with their hashes, and is only reused if they
+are all unchanged.  Outputs that embed the test's working directory (e.g.
+debug info or `__FILE__`) are never stored, since they would not be valid in
+another test's directory.
+"""
+
+import hashlib
+import json
+import logging
+import os
+import shutil
+import subprocess
+import tempfile
+
+from tools import cache, config, shared, utils
+from tools.shared import path_from_root
+
+logger = logging.getLogger('build_cache')
+
+# Environment variables that vary between test workers without affecting the
+# build output.
+IGNORED_ENV = {'EMCC_TEMP_DIR', 'EMCC_CORES', 'EMTEST_CORES'}
+
+# Directories covered by the tree fingerprint.  Headers found under these are
+# not hashed individually when checking dependencies.
+FINGERPRINT_DIRS = ['src', 'system', 'tools', 'third_party']
+FINGERPRINT_FILES = ['emcc.py', 'emscripten.py', 'emscripten-version.txt']
+
+# Give up on keying a command that names a very large directory.
+MAX_DIR_FILES = 1000
+
+
+def get_dir():
+  return os.environ.get('EMTEST_BUILD_CACHE')
+
+
+def enabled():
+  return bool(get_dir())
+
+
+def compute_fingerprint():
+  """Summarizes the state of the toolchain that the tests are built with.
+
+  File sizes and modification times are used rather than contents so that
+  this stays cheap enough to run at the start of every test run.
+  """
+  h = hashlib.sha256()
+
+  def add_file(path):
+    try:
+      st = os.stat(path)
+    except OSError:
+      return
+    h.update(f'{path}:{st.st_size}:{st.st_mtime_ns}\n'.encode())
+
+  for d in FINGERPRINT_DIRS:
+    for root, dirs, files in os.walk(path_from_root(d)):
+      dirs.sort()
+      for f in sorted(files):
+        add_file(os.path.join(root, f))
+  for f in FINGERPRINT_FILES:
+    add_file(path_from_root(f))
+  add_file(config.EM_CONFIG)
+  add_file(shared.CLANG_CC)
+  add_file(os.path.join(config.BINARYEN_ROOT, 'bin', shared.exe_suffix('wasm-opt')))
+  return h.hexdigest()
+
+
+def get_fingerprint():
+  # The test runner computes this once and passes it to the workers through
+  # the environment.
+  if not os.environ.get('EMTEST_BUILD_CACHE_KEY'):
+    os.environ['EMTEST_BUILD_CACHE_KEY'] = compute_fingerprint()
+  return os.environ['EMTEST_BUILD_CACHE_KEY']
+
+
+def hash_file(path):
+  with open(path, 'rb') as f:
+    return hashlib.sha256(f.read()).hexdigest()
+
+
+def hash_path(path):
+  """Hashes a file, or every file under a directory (such as an include
+  directory or a directory to preload).  Returns None if the directory is too
+  large to be worth keying on."""
+  if os.path.isfile(path):
+    return hash_file(path)
+  h = hashlib.sha256()
+  count = 0
+  for root, dirs, files in os.walk(path):
+    dirs.sort()
+    for f in sorted(files):
+      count += 1
+      if count > MAX_DIR_FILES:
+        return None
+      full = os.path.join(root, f)
+      h.update(os.path.relpath(full, path).encode() + b'\0' + hash_file(full).encode() + b'\n')
+  return h.hexdigest()
+
+
+def referenced_paths(arg):
+  """Yields the paths of existing files or directories named by a single
+  command line argument, including forms such as `--pre-js=foo.js`,
+  `-Ifoo` and `--preload-file foo@/bar`."""
+  candidates = [arg]
+  if '=' in arg:
+    candidates.append(arg.split('=', 1)[1])
+  if arg.startswith('-') and len(arg) > 2 and arg[1] in 'IL':
+    candidates.append(arg[2:])
+  for c in list(candidates):
+    if '@' in c:
+      candidates.append(c.split('@', 1)[0])
+  for c in candidates:
+    if c and os.path.exists(c):
+      yield c
+
+
+def command_key(cmd, working_dir):
+  """Returns the cache key for running `cmd` in `working_dir`, or None if the
+  command cannot be cached."""
+  h = hashlib.sha256()
+  h.update(get_fingerprint().encode() + b'\n')
+  for name, value in sorted(os.environ.items()):
+    if (name.startswith('EMCC_') or name.startswith('EM_')) and name not in IGNORED_ENV:
+      h.update(f'env:{name}={value}\n'.encode())
+  cmd = [str(a) for a in cmd]
+  for i, arg in enumerate(cmd):
+    h.update(b'arg:' + arg.replace(working_dir, '{dir}').encode() + b'\n')
+    # The output file may be left over from an earlier build in this test.
+    if i > 0 and cmd[i - 1] == '-o':
+      continue
+    for path in referenced_paths(arg):
+      digest = hash_path(path)
+      if digest is None:
+        return None
+      h.update(f'path:{digest}\n'.encode())
+  return h.hexdigest()
+
+
+def is_fingerprinted(path):
+  path = os.path.realpath(path)
+  roots = [os.path.realpath(path_from_root(d)) for d in FINGERPRINT_DIRS]
+  roots.append(os.path.realpath(cache.get_sysroot_dir()))
+  return any(path.startswith(r + os.sep) for r in roots)
+
+
+def get_dependencies(cmd, working_dir):
+  """Returns {path: hash} for the sources and headers read by `cmd`, using the
+  compiler's own dependency output."""
+  cmd = [str(a) for a in cmd]
+  if '-o' in cmd:
+    i = cmd.index('-o')
+    cmd = cmd[:i] + cmd[i + 2:]
+  proc = subprocess.run(cmd + ['-M', '-Wno-error'], stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, text=True)
+  if proc.returncode != 0:
+    return None
+  text = proc.stdout.replace('\\\n', ' ').replace('\\ ', '\0')
+  deps = {}
+  for token in text.split():
+    if token.endswith(':'):
+      continue
+    path = token.replace('\0', ' ')
+    if is_fingerprinted(path):
+      continue
+    full = os.path.join(working_dir, path)
+    if not os.path.isfile(full):
+      return None
+    rel = os.path.relpath(full, working_dir)
+    deps[rel if not rel.startswith('..') else full] = hash_file(full)
+  return deps
+
+
+def snapshot(working_dir):
+  files = {}
+  for root, _, names in os.walk(working_dir):
+    for name in names:
+      full = os.path.join(root, name)
+      st = os.stat(full)
+      files[os.path.relpath(full, working_dir)] = (st.st_size, st.st_mtime_ns)
+  return files
+
+
+def entry_dir(key):
+  return os.path.join(get_dir(), key[:2], key)
+
+
+def restore(key, working_dir):
+  entry = entry_dir(key)
+  try:
+    manifest = json.loads(utils.read_file(os.path.join(entry, 'manifest.json')))
+    for path, digest in manifest['deps'].items():
+      full = os.path.join(working_dir, path)
+      if not os.path.isfile(full) or hash_file(full) != digest:
+        return False
+    for name in manifest['outputs']:
+      dest = os.path.join(working_dir, name)
+      utils.safe_ensure_dirs(os.path.dirname(dest))
+      shutil.copyfile(os.path.join(entry, 'files', name), dest)
+  except (OSError, ValueError, KeyError):
+    # Missing, stale or concurrently replaced entry.
+    return False
+  logger.debug(f'build cache hit: {key}')
+  return True
+
+
+def store(key, cmd, working_dir, before):
+  after = snapshot(working_dir)
+  outputs = [f for f, st in after.items() if before.get(f) != st]
+  if not outputs:
+    return
+  markers = {working_dir.encode(), os.path.realpath(working_dir).encode()}
+  for name in outputs:
+    data = utils.read_binary(os.path.join(working_dir, name))
+    if any(m in data for m in markers):
+      logger.debug(f'not caching build that embeds its working directory: {name}')
+      return
+  deps = get_dependencies(cmd, working_dir)
+  if deps is None:
+    return
+  # Populate the entry to one side and then move it into place, so that other
+  # workers never see a partially written entry.
+  utils.safe_ensure_dirs(get_dir())
+  tmp = tempfile.mkdtemp(prefix='tmp_', dir=get_dir())
+  try:
+    for name in outputs:
+      dest = os.path.join(tmp, 'files', name)
+      utils.safe_ensure_dirs(os.path.dirname(dest))
+      shutil.copyfile(os.path.join(working_dir, name), dest)
+    utils.write_file(os.path.join(tmp, 'manifest.json'), json.dumps({'deps': deps, 'outputs': outputs}))
+    entry = entry_dir(key)
+    utils.safe_ensure_dirs(os.path.dirname(entry))
+    shutil.rmtree(entry, ignore_errors=True)
+    os.replace(tmp, entry)
+  except OSError:
+    # Another worker got there first.
+    pass
+  finally:
+    shutil.rmtree(tmp, ignore_errors=True)
+
+
+def run_cached(cmd, working_dir, run):
+  """Runs `run()`, which executes `cmd` in `working_dir`, unless the cache
+  already holds its outputs."""
+  key = command_key(cmd, working_dir)
+  if key is None:
+    run()
+    return
+  if restore(key, working_dir):
+    return
+  before = snapshot(working_dir)
+  run()
+  store(key, cmd, working_dir, before)
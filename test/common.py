@@ -31,6 +31,7 @@ import webbrowser
 import unittest
 import queue
 
+import build_cache
 import clang_native
 import jsrun
 from tools.shared import EMCC, EMXX, DEBUG, EMCONFIGURE, EMCMAKE
@@ -1232,7 +1233,13 @@ class RunnerCore(unittest.TestCase, metaclass=RunnerMeta):
     if includes:
       cmd += ['-I' + str(include) for include in includes]
 
-    self.run_process(cmd, stderr=self.stderr_redirect if not DEBUG else None)
+    def run():
+      self.run_process(cmd, stderr=self.stderr_redirect if not DEBUG else None)
+
+    if build_cache.enabled():
+      build_cache.run_cached(cmd, self.get_dir(), run)
+    else:
+      run()
     self.assertExists(output)
 
     return output
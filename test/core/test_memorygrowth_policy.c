@@ -0,0 +1,73 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <emscripten.h>
+#include <emscripten/heap.h>
+
+#define MB (1024 * 1024)
+#define RESERVE (8 * MB)
+
+static size_t headroom() {
+  return emscripten_get_heap_size() - (uintptr_t)sbrk(0);
+}
+
+int main() {
+  emscripten_heap_growth_policy policy = {
+    .linear_step = 4 * MB,
+    .reserve_ahead = RESERVE,
+#ifdef BACKGROUND
+    .background = 1,
+#endif
+  };
+  int rc = emscripten_set_heap_growth_policy(&policy);
+  assert(rc == 0);
+
+  size_t initial_size = emscripten_get_heap_size();
+  char* last = NULL;
+  for (int i = 0; i < 64; i++) {
+    last = malloc(MB);
+    assert(last);
+#ifndef BACKGROUND
+    // The reserve is topped up synchronously after each sbrk.
+    assert(headroom() >= RESERVE);
+#endif
+  }
+#ifdef BACKGROUND
+  // Wait for the background thread to catch up.
+  while (headroom() < RESERVE) {
+    usleep(1000);
+  }
+#endif
+  assert(emscripten_get_heap_size() > initial_size);
+
+  // Touch the new memory from JS, which refreshes the views if another thread
+  // grew it.
+  EM_ASM({ HEAP8[$0] = 42; }, last);
+  assert(last[0] == 42);
+
+  emscripten_heap_growth_stats stats;
+  emscripten_get_heap_growth_stats(&stats);
+  printf("early grows: %d\n", stats.early_grows > 0);
+#ifdef BACKGROUND
+  printf("view refreshes: %d\n", stats.view_refreshes > 0);
+#else
+  // Every allocation fit into the reserve.
+  printf("sync grows: %zu\n", stats.sync_grows);
+  printf("view refreshes: %zu\n", stats.view_refreshes);
+#endif
+
+  // Restore the default policy.
+  rc = emscripten_set_heap_growth_policy(NULL);
+  assert(rc == 0);
+  printf("done\n");
+  return 0;
+}
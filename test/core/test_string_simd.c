@@ -0,0 +1,112 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+// Checks the string routines against simple byte-at-a-time versions, for all
+// alignments and for strings that end near a wasm page boundary.
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PAGE 65536
+
+static const char alphabet[] = "abcd\x80\xff";
+
+static char pick() {
+  return alphabet[rand() % (sizeof(alphabet) - 1)];
+}
+
+static int sign(int x) {
+  return (x > 0) - (x < 0);
+}
+
+static size_t ref_strlen(const char* s) {
+  size_t n = 0;
+  while (s[n]) n++;
+  return n;
+}
+
+static const void* ref_memchr(const void* s, int c, size_t n) {
+  const unsigned char* p = s;
+  for (size_t i = 0; i < n; i++) {
+    if (p[i] == (unsigned char)c) return p + i;
+  }
+  return NULL;
+}
+
+static int ref_memcmp(const void* a, const void* b, size_t n) {
+  const unsigned char *l = a, *r = b;
+  for (size_t i = 0; i < n; i++) {
+    if (l[i] != r[i]) return l[i] - r[i];
+  }
+  return 0;
+}
+
+static int ref_strcmp(const char* a, const char* b) {
+  const unsigned char *l = (const unsigned char*)a, *r = (const unsigned char*)b;
+  while (*l && *l == *r) l++, r++;
+  return *l - *r;
+}
+
+static size_t ref_span(const char* s, const char* set, int accept) {
+  size_t n = 0;
+  for (; s[n]; n++) {
+    if ((strchr(set, s[n]) != NULL) != accept) break;
+  }
+  return n;
+}
+
+int main() {
+  char* buf1 = aligned_alloc(PAGE, 2 * PAGE);
+  char* buf2 = aligned_alloc(PAGE, 2 * PAGE);
+  srand(1);
+  for (int i = 0; i < 20000; i++) {
+    // Place strings at every alignment, and every few iterations right up
+    // against the page boundary.
+    int off1 = i % 3 ? rand() % 64 : PAGE - 1 - rand() % 40;
+    int off2 = i % 5 ? rand() % 64 : PAGE - 1 - rand() % 40;
+    int len = rand() % 80;
+    if (off1 + len >= 2 * PAGE) len = 2 * PAGE - off1 - 1;
+    char* s = buf1 + off1;
+    char* t = buf2 + off2;
+    for (int j = 0; j < len; j++) s[j] = pick();
+    s[len] = 0;
+
+    assert(strlen(s) == ref_strlen(s));
+
+    char c = pick();
+    size_t n = rand() % (len + 1);
+    assert(memchr(s, c, n) == ref_memchr(s, c, n));
+    assert(memchr(s, 0, SIZE_MAX) == s + len);
+    assert(strchr(s, c) == ref_memchr(s, c, len));
+    assert(strchr(s, 0) == s + len);
+
+    int len2 = len;
+    if (off2 + len2 >= 2 * PAGE) len2 = 2 * PAGE - off2 - 1;
+    memcpy(t, s, len2);
+    t[len2] = 0;
+    if (len2 && rand() % 2) t[rand() % len2] = pick();
+    if (rand() % 4 == 0) t[rand() % (len2 + 1)] = 0;
+    assert(sign(strcmp(s, t)) == sign(ref_strcmp(s, t)));
+    assert(sign(strcmp(t, s)) == sign(ref_strcmp(t, s)));
+    n = rand() % (len2 + 1);
+    assert(sign(memcmp(s, t, n)) == sign(ref_memcmp(s, t, n)));
+
+    char set[5];
+    int setlen = rand() % 5;
+    for (int j = 0; j < setlen; j++) set[j] = pick();
+    set[setlen] = 0;
+    assert(strspn(s, set) == ref_span(s, set, 1));
+    assert(strcspn(s, set) == ref_span(s, set, 0));
+  }
+  free(buf1);
+  free(buf2);
+  puts("ok");
+  return 0;
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <emscripten.h>
+
+// stringToUTF8 writes lone surrogates as three bytes (WTF-8), for short strings
+// and for long ones alike.
+static void check(int padding, int surrogate) {
+  unsigned char buf[64];
+  int len = EM_ASM_INT({
+    return stringToUTF8('x'.repeat($2) + String.fromCharCode($3) + 'y', $0, $1);
+  }, buf, sizeof(buf), padding, surrogate);
+  printf("%d %x: %d bytes, %02x %02x %02x\n", padding, surrogate, len,
+         buf[padding], buf[padding + 1], buf[padding + 2]);
+  assert(len == padding + 4);
+  for (int i = 0; i < padding; i++) {
+    assert(buf[i] == 'x');
+  }
+  assert(buf[padding + 3] == 'y');
+  assert(buf[padding + 4] == 0);
+}
+
+int main() {
+  check(1, 0xd800);
+  check(1, 0xdc00);
+  check(40, 0xd800);
+  check(40, 0xdc00);
+  return 0;
+}
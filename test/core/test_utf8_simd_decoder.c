@@ -0,0 +1,62 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <emscripten.h>
+
+// Without TextDecoder, UTF8ToString decodes strings over 64 bytes in wasm and
+// shorter ones in JS.  Both must decode invalid UTF-8 the same way, so check
+// each sequence below after a short and a long run of ASCII.
+static const char* sequences[] = {
+  "\xed\xa0\x80",     // lone surrogate, as written by stringToUTF8
+  "\xed\xb0\x80",     // lone trailing surrogate
+  "\xc0\x80",         // overlong NUL
+  "\xe0\x80\x80",     // overlong 3-byte form
+  "\x80\x80\x80\x80", // continuation bytes without a leading byte
+  "\xf8\x88\x80\x80", // leading byte of a 5-byte sequence
+  "\xf4\x90\x80\x80", // above U+10FFFF
+  "\xe2\x82",         // truncated 3-byte sequence
+  "\xf0",             // truncated 4-byte sequence at the very end
+};
+
+static void check(int padding, const char* seq) {
+  // Zero the bytes past the terminator, which the decoders read for truncated
+  // sequences.
+  char buf[256] = {0};
+  memset(buf, 'x', padding);
+  strcpy(buf + padding, seq);
+  int same = EM_ASM_INT({
+    var array = Array.from(HEAPU8.subarray($0, $0 + $1 + 4));
+    return UTF8ToString($0) === UTF8ArrayToString(array, 0);
+  }, buf, strlen(buf));
+  printf("%d %02x: %s\n", padding, (unsigned char)seq[0], same ? "same" : "different");
+  assert(same);
+}
+
+// Lone surrogates written by stringToUTF8 read back unchanged.
+static void check_round_trip(int padding) {
+  char buf[256];
+  int same = EM_ASM_INT({
+    var str = 'x'.repeat($2) + String.fromCharCode(0xD800) + 'y' + String.fromCharCode(0xDC00);
+    stringToUTF8(str, $0, $1);
+    return UTF8ToString($0) === str;
+  }, buf, sizeof(buf), padding);
+  printf("%d round trip: %s\n", padding, same ? "same" : "different");
+  assert(same);
+}
+
+int main() {
+  for (int i = 0; i < sizeof(sequences) / sizeof(sequences[0]); i++) {
+    check(20, sequences[i]);
+    check(100, sequences[i]);
+  }
+  check_round_trip(20);
+  check_round_trip(100);
+  return 0;
+}
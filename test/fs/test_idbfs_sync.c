@@ -9,6 +9,7 @@
 #include <emscripten.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <errno.h>
 #include <string.h>
@@ -73,6 +74,31 @@ void test() {
   else if (mkdir("/working1/dir", 0777) != 0)
     result = -13000 - errno;
 
+  // a file that is synced, and then modified only through a shared mapping.
+  // The database is already open, so an incremental syncfs() stores the file
+  // before returning, and only the write through the mapping is left for the
+  // final one.
+  if ((stat("/working1/mmap.txt", &st) != -1) || (errno != ENOENT))
+    result = -30000 - errno;
+  fd = open("/working1/mmap.txt", O_RDWR | O_CREAT, 0666);
+  if (fd == -1)
+    result = -31000 - errno;
+  else {
+    if (write(fd, "abcdefgh", 8) != 8)
+      result = -32000 - errno;
+    EM_ASM(FS.syncfs(function (err) { assert(!err); }));
+    char* p = mmap(NULL, 8, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED)
+      result = -33000 - errno;
+    else {
+      p[5] = 'X';
+      if (munmap(p, 8) != 0)
+        result = -34000 - errno;
+    }
+    if (close(fd) != 0)
+      result = -35000 - errno;
+  }
+
 #else
 
   // does the empty file exist?
@@ -131,6 +157,21 @@ void test() {
       result = -29000 - errno;
   }
 
+  // were the changes written through the mapping persisted?
+  fd = open("/working1/mmap.txt", O_RDONLY);
+  if (fd == -1) {
+    result = -36000 - errno;
+  } else {
+    char bf[16];
+    int bytes_read = read(fd, &bf[0], sizeof(bf));
+    if (bytes_read != 8 || memcmp(bf, "abcdeXgh", 8) != 0)
+      result = -37000;
+    if (close(fd) != 0)
+      result = -38000 - errno;
+    if (unlink("/working1/mmap.txt") != 0)
+      result = -39000 - errno;
+  }
+
 #endif
 
   // If the test failed, then delete test files from IndexedDB so that the test
@@ -141,6 +182,7 @@ void test() {
     unlink("/working1/waka.txt");
     unlink("/working1/moar.txt");
     rmdir("/working1/dir");
+    unlink("/working1/mmap.txt");
     EM_ASM(FS.syncfs(function(){})); // And persist deleted changes
   }
 
@@ -178,7 +220,12 @@ int main() {
     FS.mkdir('/working1');
     FS.mount(IDBFS, { 
 #ifdef IDBFS_AUTO_PERSIST
-      autoPersist: true
+      autoPersist: true,
+#endif
+#ifdef IDBFS_INCREMENTAL
+      incremental: true,
+      // Small enough that SECRET is stored as multiple chunks.
+      chunkSize: 4,
 #endif
     }, '/working1');
 
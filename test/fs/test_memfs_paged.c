@@ -0,0 +1,86 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <assert.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <emscripten/emscripten.h>
+
+// Exercises MEMFS file storage across page boundaries.  This is run with a
+// tiny MEMFS_PAGE_SIZE so that every operation straddles several pages.
+
+int main() {
+  int fd = open("paged", O_RDWR | O_CREAT | O_TRUNC, 0666);
+  assert(fd >= 0);
+
+  // Many small appends.
+  char buf[1000];
+  for (int i = 0; i < 1000; i++) {
+    char c = 'a' + i % 26;
+    assert(write(fd, &c, 1) == 1);
+  }
+  struct stat st;
+  fstat(fd, &st);
+  assert(st.st_size == 1000);
+
+  assert(pread(fd, buf, sizeof(buf), 0) == 1000);
+  for (int i = 0; i < 1000; i++) {
+    assert(buf[i] == 'a' + i % 26);
+  }
+
+  // Overwrite a range in the middle that spans pages.
+  memset(buf, 'X', 100);
+  assert(pwrite(fd, buf, 100, 450) == 100);
+  assert(pread(fd, buf, 3, 449) == 3);
+  assert(buf[0] == 'a' + 449 % 26 && buf[1] == 'X' && buf[2] == 'X');
+  assert(pread(fd, buf, 2, 549) == 2);
+  assert(buf[0] == 'X' && buf[1] == 'a' + 550 % 26);
+
+  // Writing past the end leaves a hole that reads back as zeros.
+  assert(pwrite(fd, "end", 3, 2000) == 3);
+  assert(pread(fd, buf, 1003, 1000) == 1003);
+  for (int i = 0; i < 1000; i++) {
+    assert(buf[i] == 0);
+  }
+  assert(memcmp(buf + 1000, "end", 3) == 0);
+
+  // Truncating clears data past the new end, even when it is re-extended.
+  assert(ftruncate(fd, 10) == 0);
+  assert(ftruncate(fd, 100) == 0);
+  assert(pread(fd, buf, 100, 0) == 100);
+  assert(memcmp(buf, "abcdefghij", 10) == 0);
+  for (int i = 10; i < 100; i++) {
+    assert(buf[i] == 0);
+  }
+
+  // mmap copies directly out of the pages.
+  char* p = mmap(NULL, 100, PROT_READ, MAP_PRIVATE, fd, 0);
+  assert(p != MAP_FAILED);
+  assert(memcmp(p, "abcdefghij", 10) == 0);
+  assert(p[50] == 0);
+  munmap(p, 100);
+
+  // Extending the file with posix_fallocate after its contiguous form has been
+  // materialized (here by FS.readFile) must not leave a stale copy behind.
+  assert(EM_ASM_INT(return FS.readFile('paged').length) == 100);
+  assert(posix_fallocate(fd, 0, 200) == 0);
+  assert(EM_ASM_INT(return FS.readFile('paged').length) == 200);
+  assert(EM_ASM_INT(return FS.readFile('paged')[150]) == 0);
+  assert(pread(fd, buf, 200, 0) == 200);
+  assert(memcmp(buf, "abcdefghij", 10) == 0);
+  for (int i = 10; i < 200; i++) {
+    assert(buf[i] == 0);
+  }
+
+  close(fd);
+  puts("success");
+  return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <assert.h>
+#include <emscripten.h>
+#include <emscripten/eventloop.h>
+#include <emscripten/html5.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int moves, movement, clicks;
+
+EM_BOOL mouse_callback(int eventType, const EmscriptenMouseEvent *e, void *userData) {
+  printf("event %d movementX %d\n", eventType, e->movementX);
+  if (eventType == EMSCRIPTEN_EVENT_MOUSEMOVE) {
+    moves++;
+    movement += e->movementX;
+  } else {
+    clicks++;
+  }
+  return 0;
+}
+
+int received, out_of_order;
+
+EM_BOOL order_callback(int eventType, const EmscriptenMouseEvent *e, void *userData) {
+  if (e->movementX != received) {
+    out_of_order++;
+  }
+  received++;
+  return 0;
+}
+
+void dispatch_events() {
+  MAIN_THREAD_EM_ASM({
+    for (var i = 0; i < 10; i++) {
+      window.dispatchEvent(new MouseEvent('mousemove', { movementX: 1 }));
+    }
+    window.dispatchEvent(new MouseEvent('mousedown'));
+    window.dispatchEvent(new MouseEvent('mousemove', { movementX: 5 }));
+  });
+}
+
+EM_BOOL check_auto_drain(double time, void* arg) {
+  // Without manual draining the whole batch is delivered once this thread
+  // returns to its event loop.
+  if (!clicks) {
+    return EM_TRUE;
+  }
+  printf("auto: moves %d movement %d clicks %d\n", moves, movement, clicks);
+  assert(moves == 2);
+  assert(movement == 15);
+  assert(clicks == 1);
+  exit(0);
+  return EM_FALSE;
+}
+
+int main() {
+  assert(!emscripten_is_main_browser_thread());
+  EMSCRIPTEN_RESULT ret = emscripten_html5_enable_event_ring(EM_EVENT_RING_COALESCE_MOVES | EM_EVENT_RING_MANUAL_DRAIN);
+  assert(ret == EMSCRIPTEN_RESULT_SUCCESS);
+
+  emscripten_set_mousemove_callback_on_thread(EMSCRIPTEN_EVENT_TARGET_WINDOW, 0, 1, mouse_callback, EM_CALLBACK_THREAD_CONTEXT_CALLING_THREAD);
+  emscripten_set_mousedown_callback_on_thread(EMSCRIPTEN_EVENT_TARGET_WINDOW, 0, 1, mouse_callback, EM_CALLBACK_THREAD_CONTEXT_CALLING_THREAD);
+
+  // In manual mode nothing is delivered until the ring is drained, and the ten
+  // consecutive moves collapse into one event carrying their total movement.
+  dispatch_events();
+  assert(moves == 0 && clicks == 0);
+  int count = emscripten_html5_process_event_ring();
+  printf("manual: count %d moves %d movement %d clicks %d\n", count, moves, movement, clicks);
+  assert(count == 3);
+  assert(moves == 2);
+  assert(movement == 15);
+  assert(clicks == 1);
+  assert(emscripten_html5_process_event_ring() == 0);
+
+  // Events that do not fit in the ring are queued behind it, in order.
+  ret = emscripten_html5_enable_event_ring(EM_EVENT_RING_MANUAL_DRAIN);
+  assert(ret == EMSCRIPTEN_RESULT_SUCCESS);
+  emscripten_set_mousemove_callback_on_thread(EMSCRIPTEN_EVENT_TARGET_WINDOW, 0, 1, order_callback, EM_CALLBACK_THREAD_CONTEXT_CALLING_THREAD);
+  MAIN_THREAD_EM_ASM({
+    for (var i = 0; i < 300; i++) {
+      window.dispatchEvent(new MouseEvent('mousemove', { movementX: i }));
+    }
+  });
+  count = emscripten_html5_process_event_ring();
+  printf("overflow: count %d received %d out of order %d\n", count, received, out_of_order);
+  assert(count == 300);
+  assert(received == 300);
+  assert(out_of_order == 0);
+  emscripten_set_mousemove_callback_on_thread(EMSCRIPTEN_EVENT_TARGET_WINDOW, 0, 1, mouse_callback, EM_CALLBACK_THREAD_CONTEXT_CALLING_THREAD);
+
+  moves = movement = clicks = 0;
+  ret = emscripten_html5_enable_event_ring(EM_EVENT_RING_COALESCE_MOVES);
+  assert(ret == EMSCRIPTEN_RESULT_SUCCESS);
+  dispatch_events();
+  emscripten_set_timeout_loop(check_auto_drain, 10, NULL);
+  emscripten_exit_with_live_runtime();
+  return 0;
+}
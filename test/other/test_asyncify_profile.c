@@ -0,0 +1,30 @@
+#include <emscripten.h>
+#include <stdio.h>
+
+int counter = 0;
+
+EM_JS(void, async_func, (), {
+  Asyncify.handleSleep(wakeUp => setTimeout(wakeUp, 0));
+});
+
+EMSCRIPTEN_KEEPALIVE void never_sleeps(int n) {
+  for (int i = 0; i < n; i++) counter++;
+}
+
+EMSCRIPTEN_KEEPALIVE void sleeps(void) {
+  async_func();
+  counter++;
+}
+
+EMSCRIPTEN_KEEPALIVE void calls_sleeps(void) {
+  sleeps();
+  counter++;
+}
+
+int main() {
+  never_sleeps(10);
+  calls_sleeps();
+  sleeps();
+  printf("counter: %d\n", counter);
+  return 0;
+}
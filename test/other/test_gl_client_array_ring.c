@@ -0,0 +1,81 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+// Checks the GL calls made for client-side vertex arrays with
+// GL_CLIENT_ARRAY_RING_BUFFER_SIZE, against a mock WebGL context that only
+// counts them, so that it can run headless.
+
+#include <GLES2/gl2.h>
+#include <emscripten/emscripten.h>
+#include <emscripten/html5.h>
+#include <stdio.h>
+
+EM_JS(EMSCRIPTEN_WEBGL_CONTEXT_HANDLE, create_mock_context, (), {
+  var counts = { createBuffer: 0, deleteBuffer: 0, bufferData: 0, bufferSubData: 0 };
+  var live = new Set();
+  var nextBuffer = 1;
+  Module['glCounts'] = counts;
+  Module['glLiveBuffers'] = live;
+  Module['preinitializedWebGLContext'] = new Proxy({
+    getParameter: (param) => param == 0x8869 /*GL_MAX_VERTEX_ATTRIBS*/ ? 16 : 0,
+    getExtension: () => null,
+    getSupportedExtensions: () => [],
+    createBuffer: () => {
+      counts.createBuffer++;
+      var buffer = { id: nextBuffer++ };
+      live.add(buffer);
+      return buffer;
+    },
+    deleteBuffer: (buffer) => {
+      counts.deleteBuffer++;
+      live.delete(buffer);
+    },
+    bufferData: () => counts.bufferData++,
+    bufferSubData: () => counts.bufferSubData++,
+    currentArrayBufferBinding: null,
+    currentElementArrayBufferBinding: null,
+  }, {
+    // Every other WebGL call is a no-op.
+    get: (target, prop) => prop in target ? target[prop] : () => {},
+  });
+  return GL.createContext({}, { majorVersion: 1 });
+});
+
+EM_JS(void, print_counts, (const char* label), {
+  var counts = Module['glCounts'];
+  out(`${UTF8ToString(label)}: buffers=${counts.createBuffer} deleted=${counts.deleteBuffer} allocations=${counts.bufferData} uploads=${counts.bufferSubData} live=${Module['glLiveBuffers'].size}`);
+});
+
+// Interleaved position and color.
+static float vertices[256][4];
+
+static void draw(int count) {
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 16, &vertices[0][0]);
+  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 16, &vertices[0][2]);
+  glDrawArrays(GL_TRIANGLES, 0, count);
+}
+
+int main() {
+  EMSCRIPTEN_WEBGL_CONTEXT_HANDLE context = create_mock_context();
+  emscripten_webgl_make_context_current(context);
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+
+  // Each draw uploads both attributes with a single call into the same
+  // buffer.
+  for (int i = 0; i < 10; i++) {
+    draw(3);
+  }
+  print_counts("small draws");
+
+  // A draw larger than the ring (4096 > 1024 bytes) replaces the buffer.
+  draw(256);
+  print_counts("large draw");
+  draw(3);
+  print_counts("after growth");
+  return 0;
+}
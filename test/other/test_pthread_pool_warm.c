@@ -0,0 +1,56 @@
+#include <emscripten/emscripten.h>
+#include <emscripten/eventloop.h>
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#define BURST 3
+
+static atomic_int release;
+
+int idleWorkers() {
+  return EM_ASM_INT(return PThread.unusedWorkers.length);
+}
+
+void* thread_main(void* arg) {
+  // Keep the worker busy until the refill has been checked, so that it cannot
+  // be returned to the pool in the meantime.
+  while (!atomic_load(&release)) {
+    usleep(1000);
+  }
+  return NULL;
+}
+
+void checkRefilled(void* arg) {
+  // All the threads from the burst are still running, so every idle worker
+  // was created by the background refill, which is sized after the last
+  // burst.
+  int unused = idleWorkers();
+  printf("after burst: idle=%d\n", unused);
+  assert(unused == BURST);
+  atomic_store(&release, 1);
+  printf("done\n");
+}
+
+void startBurst(void* arg) {
+  // By now the background refill has created the warm pool.
+  printf("warm pool: %d\n", idleWorkers());
+  assert(idleWorkers() == 2);
+  for (int i = 0; i < BURST; i++) {
+    pthread_t t;
+    pthread_create(&t, NULL, thread_main, NULL);
+    pthread_detach(t);
+  }
+  emscripten_set_timeout(checkRefilled, 500, NULL);
+}
+
+int main() {
+  printf("in main\n");
+  // Workers are not loaded before main when only PTHREAD_POOL_WARM is set.
+  assert(idleWorkers() == 0);
+  emscripten_set_timeout(startBurst, 0, NULL);
+  return 0;
+}
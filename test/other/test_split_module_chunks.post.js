@@ -0,0 +1,31 @@
+// The instrumented build writes one profile at startup and another one after
+// calling say_hello(), so that the split build puts say_hello() into a chunk
+// that is prefetched.
+function writeProfile(name) {
+  var __write_profile = wasmExports['__write_profile'];
+  var len = __write_profile(0, 0);
+  var offset = _malloc(len);
+  __write_profile(offset, len);
+  fs.writeFileSync(name, HEAPU8.subarray(offset, offset + len));
+  _free(offset);
+  out(`wrote ${name}`);
+}
+
+function callWhenPrefetched() {
+  if (!splitChunkModules.some((module) => module)) {
+    setTimeout(callWhenPrefetched, 10);
+    return;
+  }
+  out('chunk compiled ahead of its first call');
+  _say_hello();
+}
+
+addOnPostRun(() => {
+  if (wasmExports['__write_profile']) {
+    writeProfile('startup.data');
+    _say_hello();
+    writeProfile('later.data');
+  } else {
+    callWhenPrefetched();
+  }
+});
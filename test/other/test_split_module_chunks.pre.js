@@ -0,0 +1,6 @@
+// Report secondary modules that have to be loaded synchronously, when one of
+// their functions is first called.
+Module['loadSplitModule'] = (file, imports, prop) => {
+  out(`loading ${file} synchronously for table slot ${prop}`);
+  return instantiateSync(file, imports);
+};
@@ -3,6 +3,8 @@
 # University of Illinois/NCSA Open Source License.  Both these licenses can be
 # found in the LICENSE file.
 
+import json
+import math
 import multiprocessing
 import os
 import sys
@@ -12,11 +14,16 @@ import unittest
 
 import common
 
-from tools.shared import cap_max_workers_in_pool
+from tools.shared import cap_max_workers_in_pool, path_from_root
+from tools import utils
 
 
 NUM_CORES = None
 
+# Per-test durations (in seconds) from previous runs, used to schedule the
+# slowest tests first.
+DURATIONS_FILE = path_from_root('out/test_durations.json')
+
 
 def run_test(test):
   olddir = os.getcwd()
@@ -57,7 +64,7 @@ class ParallelTestSuite(unittest.BaseTestSuite):
     # inherited by the child process, but can lead to hard-to-debug windows-only
     # issues.
     # multiprocessing.set_start_method('spawn')
-    tests = list(self.reversed_tests())
+    tests = self.sorted_tests()
     use_cores = cap_max_workers_in_pool(min(self.max_cores, len(tests), num_cores()))
     print('Using %s parallel test processes' % use_cores)
     pool = multiprocessing.Pool(use_cores)
@@ -67,17 +74,21 @@ class ParallelTestSuite(unittest.BaseTestSuite):
     pool.join()
     return self.combine_results(result, results)
 
-  def reversed_tests(self):
-    """A list of this suite's tests, sorted reverse alphabetical order.
+  def sorted_tests(self):
+    """A list of this suite's tests, longest first.
 
-    Many of the tests in test_core are intentionally named so that long tests
-    fall toward the end of the alphabet (e.g. test_the_bullet). Tests are
-    loaded in alphabetical order, so here we reverse that in order to start
-    running longer tasks earlier, which should lead to better core utilization.
+    Tests are ordered by how long they took on previous runs, so that the
+    slowest ones start early rather than running alone at the end, which leads
+    to better core utilization.
 
-    Future work: measure slowness of tests and sort accordingly.
+    Tests with no recorded duration are treated as the slowest, and among
+    themselves are sorted in reverse alphabetical order: many of the tests in
+    test_core are intentionally named so that long tests fall toward the end
+    of the alphabet (e.g. test_the_bullet).
     """
-    return reversed(sorted(self, key=str))
+    durations = load_durations()
+    tests = sorted(self, key=str, reverse=True)
+    return sorted(tests, key=lambda t: durations.get(t.id(), math.inf), reverse=True)
 
   def combine_results(self, result, buffered_results):
     print()
@@ -88,6 +99,8 @@ class ParallelTestSuite(unittest.BaseTestSuite):
     results = sorted(buffered_results, key=lambda res: str(res.test))
     for r in results:
       r.updateResult(result)
+    save_durations({r.test.id(): r.buffered_result.duration for r in results
+                    if hasattr(r.buffered_result, 'duration')})
     return result
 
 
@@ -247,6 +260,25 @@ class FakeCode():
       self.positions = None
 
 
+def load_durations():
+  try:
+    return json.loads(utils.read_file(DURATIONS_FILE))
+  except (OSError, ValueError):
+    return {}
+
+
+def save_durations(new_durations):
+  """Merges the durations from this run into DURATIONS_FILE."""
+  if not new_durations:
+    return
+  durations = load_durations()
+  durations.update(new_durations)
+  utils.safe_ensure_dirs(os.path.dirname(DURATIONS_FILE))
+  tmp = DURATIONS_FILE + '.tmp'
+  utils.write_file(tmp, json.dumps(durations, indent=1, sort_keys=True) + '\n')
+  os.replace(tmp, DURATIONS_FILE)
+
+
 def num_cores():
   if NUM_CORES:
     return int(NUM_CORES)
@@ -0,0 +1,64 @@
+// Copyright 2024 The Emscripten Authors.  All rights reserved.
+// Emscripten is available under two separate licenses, the MIT license and the
+// University of Illinois/NCSA Open Source License.  Both these licenses can be
+// found in the LICENSE file.
+
+// Test that a futex wait on the main browser thread is woken while it runs a
+// proxied call that does a futex wait of its own, even if the value at the
+// address does not change.
+
+#include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <emscripten/proxying.h>
+#include <emscripten/threading.h>
+
+_Atomic uint32_t outer = 0;
+_Atomic uint32_t inner = 0;
+_Atomic int in_inner_wait = 0;
+
+void inner_wait(void* arg) {
+  assert(emscripten_is_main_browser_thread());
+  in_inner_wait = 1;
+  int rc = emscripten_futex_wait(&inner, 0, 10 * 1000);
+  assert(rc == 0 || rc == -EWOULDBLOCK);
+  assert(inner == 1);
+}
+
+void* proxier(void* arg) {
+  int rc = emscripten_proxy_sync(emscripten_proxy_get_system_queue(),
+                                 emscripten_main_runtime_thread_id(),
+                                 inner_wait,
+                                 NULL);
+  assert(rc);
+  return NULL;
+}
+
+void* waker(void* arg) {
+  while (!in_inner_wait) {
+  }
+  // The main thread is waiting on `inner` inside its wait on `outer`. Wake
+  // `outer` without changing its value first.
+  int woken = emscripten_futex_wake(&outer, 1);
+  assert(woken == 1);
+  inner = 1;
+  emscripten_futex_wake(&inner, 1);
+  return NULL;
+}
+
+int main() {
+  pthread_t threads[2];
+  int rc = pthread_create(&threads[0], NULL, proxier, NULL);
+  assert(rc == 0);
+  rc = pthread_create(&threads[1], NULL, waker, NULL);
+  assert(rc == 0);
+
+  rc = emscripten_futex_wait(&outer, 0, 10 * 1000);
+  printf("outer wait returned %d\n", rc);
+  assert(rc == 0);
+
+  pthread_join(threads[0], NULL);
+  pthread_join(threads[1], NULL);
+  return 0;
+}
@@ -0,0 +1,64 @@
+// Copyright 2024 The Emscripten Authors.  All rights reserved.
+// Emscripten is available under two separate licenses, the MIT license and the
+// University of Illinois/NCSA Open Source License.  Both these licenses can be
+// found in the LICENSE file.
+
+// With GROWABLE_ARRAYBUFFERS the HEAP* views are on a resizable buffer, which
+// Web APIs such as TextDecoder, TextEncoder and crypto.getRandomValues reject.
+// Check that the JS library still works when passing them memory that another
+// thread added.
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <emscripten.h>
+#include <emscripten/heap.h>
+
+#define SIZE (64 * 1024 * 1024)
+
+static void* thread_start(void* arg) {
+  // Allocate more memory than we currently have, forcing a growth.
+  char* buffer = malloc(SIZE);
+  assert(buffer);
+  return buffer;
+}
+
+int main() {
+  size_t initial_size = emscripten_get_heap_size();
+
+  pthread_t thr;
+  int rc = pthread_create(&thr, NULL, thread_start, NULL);
+  assert(rc == 0);
+  char* buffer;
+  rc = pthread_join(thr, (void**)&buffer);
+  assert(rc == 0);
+  assert(emscripten_get_heap_size() > initial_size);
+
+  // Use the end of the allocation, which lies beyond the initial memory.
+  char* str = buffer + SIZE - 256;
+  assert((size_t)str > initial_size);
+  strcpy(str, "a string in memory grown by another thread");
+  int ok = EM_ASM_INT({
+    if (UTF8ToString($0) != 'a string in memory grown by another thread') {
+      return 0;
+    }
+    var text = 'a longer string written back with stringToUTF8: é中😀';
+    stringToUTF8(text, $1, 128);
+    return UTF8ToString($1) == text;
+  }, str, str + 128);
+  assert(ok);
+
+  memset(str, 0, 64);
+  rc = getentropy(str, 64);
+  assert(rc == 0);
+  int nonzero = 0;
+  for (int i = 0; i < 64; i++) {
+    nonzero |= str[i];
+  }
+  assert(nonzero);
+
+  free(buffer);
+  return 0;
+}
@@ -0,0 +1,47 @@
+// Copyright 2024 The Emscripten Authors.  All rights reserved.
+// Emscripten is available under two separate licenses, the MIT license and the
+// University of Illinois/NCSA Open Source License.  Both these licenses can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <numeric>
+#include <stdio.h>
+#include <vector>
+
+int main() {
+  const int n = 100000;
+  std::vector<int> v(n);
+  for (int i = 0; i < n; i++) {
+    v[i] = (i * 7919) % n;
+  }
+
+  std::sort(std::execution::par, v.begin(), v.end());
+  for (int i = 0; i < n; i++) {
+    assert(v[i] == i);
+  }
+  printf("sort ok\n");
+
+  std::for_each(std::execution::par, v.begin(), v.end(), [](int& x) { x *= 2; });
+  long long sum = std::transform_reduce(std::execution::par, v.begin(), v.end(), 0LL,
+                                        std::plus<>(), [](int x) { return (long long)x; });
+  printf("sum: %lld\n", sum);
+
+  std::vector<int> w(n);
+  std::transform(std::execution::par, v.begin(), v.end(), w.begin(), [](int x) { return x / 2; });
+  bool sorted = std::is_sorted(w.begin(), w.end());
+  printf("transform ok: %d\n", sorted && w[n - 1] == n - 1);
+
+  // Nested parallel algorithms must not deadlock.
+  std::vector<std::vector<int>> rows(16, std::vector<int>(1000, 1));
+  std::for_each(std::execution::par, rows.begin(), rows.end(), [](std::vector<int>& row) {
+    std::for_each(std::execution::par, row.begin(), row.end(), [](int& x) { x++; });
+  });
+  int total = 0;
+  for (auto& row : rows) {
+    total += std::accumulate(row.begin(), row.end(), 0);
+  }
+  printf("nested: %d\n", total);
+  return 0;
+}
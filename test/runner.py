@@ -29,12 +29,14 @@ import platform
 import random
 import sys
 import unittest
+import zlib
 
 # Setup
 
 __rootpath__ = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
 sys.path.insert(0, __rootpath__)
 
+import build_cache
 import jsrun
 import parallel_testsuite
 import common
@@ -267,7 +269,19 @@ def error_on_legacy_suite_names(args):
       utils.exit_with_error('`%s` test suite has been replaced with `%s`', a, new)
 
 
-def load_test_suites(args, modules, start_at, repeat):
+def in_shard(test, shard):
+  """Whether `test` belongs to `shard`, a (index, count) pair.
+
+  Tests are assigned to shards by a hash of their name, so that every machine
+  running a slice of the same test list picks the same split.
+  """
+  if not shard:
+    return True
+  index, count = shard
+  return zlib.crc32(test.id().encode()) % count == index - 1
+
+
+def load_test_suites(args, modules, start_at, repeat, shard=None):
   found_start = not start_at
 
   loader = unittest.TestLoader()
@@ -296,6 +310,8 @@ def load_test_suites(args, modules, start_at, repeat):
             found_start = True
           else:
             continue
+        if not in_shard(test, shard):
+          continue
         for _x in range(repeat):
           total_tests += 1
           suite.addTest(test)
@@ -393,9 +409,27 @@ def parse_args(args):
   parser.add_argument('--crossplatform-only', action='store_true')
   parser.add_argument('--repeat', type=int, default=1,
                       help='Repeat each test N times (default: 1).')
+  parser.add_argument('--shard', type=parse_shard, metavar='I/N',
+                      help='Run only the I-th of N deterministic slices of the '
+                           'selected tests (e.g. --shard=2/4).')
+  parser.add_argument('--build-cache', nargs='?', metavar='DIR',
+                      const=utils.path_from_root('out/build_cache'),
+                      help='Reuse the outputs of identical test builds, across '
+                           'tests and test runs, from DIR (default: out/build_cache). '
+                           'Can also be set with EMTEST_BUILD_CACHE.')
   return parser.parse_args()
 
 
+def parse_shard(value):
+  try:
+    index, count = [int(x) for x in value.split('/')]
+  except ValueError:
+    raise argparse.ArgumentTypeError(f'expected I/N, got: {value}')
+  if count < 1 or not 1 <= index <= count:
+    raise argparse.ArgumentTypeError(f'shard index must be between 1 and {count}: {value}')
+  return (index, count)
+
+
 def configure():
   common.EMTEST_BROWSER = os.getenv('EMTEST_BROWSER')
   common.EMTEST_DETECT_TEMPFILE_LEAKS = int(os.getenv('EMTEST_DETECT_TEMPFILE_LEAKS', '0'))
@@ -453,9 +487,14 @@ def main(args):
   set_env('EMTEST_VERBOSE', options.verbose)
   set_env('EMTEST_CORES', options.cores)
   set_env('EMTEST_FORCE64', options.force64)
+  set_env('EMTEST_BUILD_CACHE', options.build_cache)
 
   configure()
 
+  if build_cache.enabled():
+    # Compute this once here, rather than in every test worker.
+    build_cache.get_fingerprint()
+
   check_js_engines()
 
   def prepend_default(arg):
@@ -479,7 +518,7 @@ def main(args):
     if os.path.exists(common.LAST_TEST):
       options.start_at = utils.read_file(common.LAST_TEST).strip()
 
-  suites, unmatched_tests = load_test_suites(tests, modules, options.start_at, options.repeat)
+  suites, unmatched_tests = load_test_suites(tests, modules, options.start_at, options.repeat, options.shard)
   if unmatched_tests:
     print('ERROR: could not find the following tests: ' + ' '.join(unmatched_tests))
     return 1
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+#include <immintrin.h>
+#include "benchmark_sse.h"
+
+int main() {
+  printf ("{ \"workload\": %u, \"results\": [\n", N);
+
+  float *src_flt = alloc_float_buffer();
+  float *src2_flt = alloc_float_buffer();
+  float *dst_flt = alloc_float_buffer();
+  for(int i = 0; i < N; ++i) src_flt[i] = (float)(1.0 + (double)rand() / RAND_MAX);
+  for(int i = 0; i < N; ++i) src2_flt[i] = (float)(1.0 + (double)rand() / RAND_MAX);
+
+  double *src_dbl = alloc_double_buffer();
+  double *src2_dbl = alloc_double_buffer();
+  double *dst_dbl = alloc_double_buffer();
+  for(int i = 0; i < N; ++i) src_dbl[i] = 1.0 + (double)rand() / RAND_MAX;
+  for(int i = 0; i < N; ++i) src2_dbl[i] = 1.0 + (double)rand() / RAND_MAX;
+
+  int *src_int = alloc_int_buffer();
+  int *dst_int = alloc_int_buffer();
+  for(int i = 0; i < N; ++i) src_int[i] = rand();
+
+  float scalarTime = 0.f;
+
+  // Benchmarks start:
+  SETCHART("load");
+  START();
+    for(int i = 0; i < N; ++i)
+      dst_flt[i] = src_flt[i];
+  ENDSCALAR(checksum_dst(dst_flt), "scalar");
+
+  LOAD_STORE_256_F("_mm256_load_ps", _mm256_load_ps, 0, _mm256_store_ps, 0);
+  LOAD_STORE_256_F("_mm256_loadu_ps", _mm256_loadu_ps, 1, _mm256_storeu_ps, 1);
+  LOAD_STORE_256_I("_mm256_load_si256", _mm256_load_si256, 0, _mm256_store_si256, 0);
+  LOAD_STORE_256_I("_mm256_lddqu_si256", _mm256_lddqu_si256, 1, _mm256_storeu_si256, 1);
+
+  SETCHART("float arithmetic");
+  START(); for(int j = 0; j < 8; ++j) dst_flt[j] = src_flt[j]; for(int i = 0; i < N; ++i) { for(int j = 0; j < 8; ++j) dst_flt[j] += src2_flt[j]; } ENDSCALAR(checksum_dst(dst_flt), "scalar add");
+  BINARYOP_256_F_FF("_mm256_add_ps", _mm256_add_ps, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  BINARYOP_256_F_FF("_mm256_addsub_ps", _mm256_addsub_ps, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  BINARYOP_256_F_FF("_mm256_hadd_ps", _mm256_hadd_ps, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  START(); for(int j = 0; j < 8; ++j) dst_flt[j] = src_flt[j]; for(int i = 0; i < N; ++i) { for(int j = 0; j < 8; ++j) dst_flt[j] *= src2_flt[j]; } ENDSCALAR(checksum_dst(dst_flt), "scalar mul");
+  BINARYOP_256_F_FF("_mm256_mul_ps", _mm256_mul_ps, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  BINARYOP_256_F_FF("_mm256_dp_ps", [](__m256 a, __m256 b) { return _mm256_dp_ps(a, b, 0xFF); }, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  START(); for(int j = 0; j < 8; ++j) dst_flt[j] = src_flt[j]; for(int i = 0; i < N; ++i) { for(int j = 0; j < 8; ++j) dst_flt[j] = Max(dst_flt[j], src2_flt[j]); } ENDSCALAR(checksum_dst(dst_flt), "scalar max");
+  BINARYOP_256_F_FF("_mm256_max_ps", _mm256_max_ps, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  BINARYOP_256_F_FF("_mm256_min_ps", _mm256_min_ps, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  UNARYOP_256_F_F("_mm256_sqrt_ps", _mm256_sqrt_ps, _mm256_load_ps(src_flt));
+  UNARYOP_256_F_F("_mm256_rcp_ps", _mm256_rcp_ps, _mm256_load_ps(src_flt));
+  UNARYOP_256_F_F("_mm256_floor_ps", _mm256_floor_ps, _mm256_load_ps(src_flt));
+
+  SETCHART("double arithmetic");
+  START(); for(int j = 0; j < 4; ++j) dst_dbl[j] = src_dbl[j]; for(int i = 0; i < N; ++i) { for(int j = 0; j < 4; ++j) dst_dbl[j] += src2_dbl[j]; } ENDSCALAR(checksum_dst(dst_dbl), "scalar add");
+  BINARYOP_256_D_DD("_mm256_add_pd", _mm256_add_pd, _mm256_load_pd(src_dbl), _mm256_load_pd(src2_dbl));
+  BINARYOP_256_D_DD("_mm256_hadd_pd", _mm256_hadd_pd, _mm256_load_pd(src_dbl), _mm256_load_pd(src2_dbl));
+  BINARYOP_256_D_DD("_mm256_mul_pd", _mm256_mul_pd, _mm256_load_pd(src_dbl), _mm256_load_pd(src2_dbl));
+  BINARYOP_256_D_DD("_mm256_div_pd", _mm256_div_pd, _mm256_load_pd(src_dbl), _mm256_load_pd(src2_dbl));
+  UNARYOP_256_D_D("_mm256_sqrt_pd", _mm256_sqrt_pd, _mm256_load_pd(src_dbl));
+
+  SETCHART("compare & blend");
+  BINARYOP_256_F_FF("_mm256_cmp_ps", [](__m256 a, __m256 b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  BINARYOP_256_F_FF("_mm256_blendv_ps", [](__m256 a, __m256 b) { return _mm256_blendv_ps(a, b, a); }, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  BINARYOP_256_D_DD("_mm256_cmp_pd", [](__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }, _mm256_load_pd(src_dbl), _mm256_load_pd(src2_dbl));
+  START(); for(int i = 0; i < N; i += 8) dst_int[i>>3] = _mm256_movemask_ps(_mm256_load_ps(src_flt+i)); END(checksum_dst(dst_int), "_mm256_movemask_ps");
+
+  SETCHART("swizzle");
+  UNARYOP_256_F_F("_mm256_permute_ps", [](__m256 a) { return _mm256_permute_ps(a, 0x1B); }, _mm256_load_ps(src_flt));
+  BINARYOP_256_F_FF("_mm256_shuffle_ps", [](__m256 a, __m256 b) { return _mm256_shuffle_ps(a, b, 0x4E); }, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  BINARYOP_256_F_FF("_mm256_unpacklo_ps", _mm256_unpacklo_ps, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  BINARYOP_256_F_FF("_mm256_permute2f128_ps", [](__m256 a, __m256 b) { return _mm256_permute2f128_ps(a, b, 0x21); }, _mm256_load_ps(src_flt), _mm256_load_ps(src2_flt));
+  UNARYOP_256_F_F("_mm256_movehdup_ps", _mm256_movehdup_ps, _mm256_load_ps(src_flt));
+
+  SETCHART("conversion");
+  UNARYOP_256_I_I("_mm256_cvtps_epi32", [](__m256i a) { return _mm256_cvtps_epi32(_mm256_castsi256_ps(a)); }, _mm256_load_si256((__m256i*)src_int));
+  UNARYOP_256_F_F("_mm256_cvtepi32_ps", [](__m256 a) { return _mm256_cvtepi32_ps(_mm256_castps_si256(a)); }, _mm256_load_ps(src_flt));
+
+  // Benchmarks end:
+  printf("]}\n");
+}
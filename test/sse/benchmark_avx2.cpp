@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+#include <immintrin.h>
+#include "benchmark_sse.h"
+
+int main() {
+  printf ("{ \"workload\": %u, \"results\": [\n", N);
+
+  int *src_int = alloc_int_buffer();
+  int *src2_int = alloc_int_buffer();
+  int *dst_int = alloc_int_buffer();
+  for(int i = 0; i < N; ++i) src_int[i] = rand();
+  for(int i = 0; i < N; ++i) src2_int[i] = rand();
+
+  float *src_flt = alloc_float_buffer();
+  float *dst_flt = alloc_float_buffer();
+  for(int i = 0; i < N; ++i) src_flt[i] = (float)(1.0 + (double)rand() / RAND_MAX);
+
+  float scalarTime = 0.f;
+
+  // Benchmarks start:
+  SETCHART("integer arithmetic");
+  START(); for(int j = 0; j < 8; ++j) dst_int[j] = src_int[j]; for(int i = 0; i < N; ++i) { for(int j = 0; j < 8; ++j) dst_int[j] += src2_int[j]; } ENDSCALAR(checksum_dst(dst_int), "scalar add");
+  BINARYOP_256_I_II("_mm256_add_epi32", _mm256_add_epi32, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_adds_epi16", _mm256_adds_epi16, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_hadd_epi32", _mm256_hadd_epi32, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  START(); for(int j = 0; j < 8; ++j) dst_int[j] = src_int[j]; for(int i = 0; i < N; ++i) { for(int j = 0; j < 8; ++j) dst_int[j] *= src2_int[j]; } ENDSCALAR(checksum_dst(dst_int), "scalar mul");
+  BINARYOP_256_I_II("_mm256_mullo_epi32", _mm256_mullo_epi32, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_mulhi_epi16", _mm256_mulhi_epi16, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_madd_epi16", _mm256_madd_epi16, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_maddubs_epi16", _mm256_maddubs_epi16, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_sad_epu8", _mm256_sad_epu8, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_max_epi32", _mm256_max_epi32, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  UNARYOP_256_I_I("_mm256_abs_epi8", _mm256_abs_epi8, _mm256_load_si256((__m256i*)src_int));
+
+  SETCHART("shift");
+  UNARYOP_256_I_I("_mm256_slli_epi32", [](__m256i a) { return _mm256_slli_epi32(a, 3); }, _mm256_load_si256((__m256i*)src_int));
+  UNARYOP_256_I_I("_mm256_srai_epi16", [](__m256i a) { return _mm256_srai_epi16(a, 3); }, _mm256_load_si256((__m256i*)src_int));
+  BINARYOP_256_I_II("_mm256_sllv_epi32", _mm256_sllv_epi32, _mm256_load_si256((__m256i*)src_int), _mm256_srli_epi32(_mm256_load_si256((__m256i*)src2_int), 27));
+  BINARYOP_256_I_II("_mm256_srav_epi32", _mm256_srav_epi32, _mm256_load_si256((__m256i*)src_int), _mm256_srli_epi32(_mm256_load_si256((__m256i*)src2_int), 27));
+
+  SETCHART("compare & blend");
+  BINARYOP_256_I_II("_mm256_cmpeq_epi8", _mm256_cmpeq_epi8, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_cmpgt_epi32", _mm256_cmpgt_epi32, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_blendv_epi8", [](__m256i a, __m256i b) { return _mm256_blendv_epi8(a, b, a); }, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  START(); for(int i = 0; i < N; i += 8) dst_int[i>>3] = _mm256_movemask_epi8(_mm256_load_si256((__m256i*)(src_int+i))); END(checksum_dst(dst_int), "_mm256_movemask_epi8");
+
+  SETCHART("swizzle");
+  BINARYOP_256_I_II("_mm256_shuffle_epi8", _mm256_shuffle_epi8, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  UNARYOP_256_I_I("_mm256_shuffle_epi32", [](__m256i a) { return _mm256_shuffle_epi32(a, 0x1B); }, _mm256_load_si256((__m256i*)src_int));
+  BINARYOP_256_I_II("_mm256_unpacklo_epi8", _mm256_unpacklo_epi8, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_packs_epi32", _mm256_packs_epi32, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  BINARYOP_256_I_II("_mm256_alignr_epi8", [](__m256i a, __m256i b) { return _mm256_alignr_epi8(a, b, 5); }, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+  UNARYOP_256_I_I("_mm256_permute4x64_epi64", [](__m256i a) { return _mm256_permute4x64_epi64(a, 0x1B); }, _mm256_load_si256((__m256i*)src_int));
+  BINARYOP_256_I_II("_mm256_permutevar8x32_epi32", _mm256_permutevar8x32_epi32, _mm256_load_si256((__m256i*)src_int), _mm256_load_si256((__m256i*)src2_int));
+
+  SETCHART("gather");
+  START(); for(int i = 0; i < N; i += 8) { for(int j = 0; j < 8; ++j) dst_flt[i+j] = src_flt[src2_int[i+j] & (N-1)]; } ENDSCALAR(checksum_dst(dst_flt), "scalar gather");
+  START();
+    __m256i mask = _mm256_set1_epi32(N-1);
+    for(int i = 0; i < N; i += 8)
+      _mm256_store_ps(dst_flt+i, _mm256_i32gather_ps(src_flt, _mm256_and_si256(_mm256_load_si256((__m256i*)(src2_int+i)), mask), 4));
+  END(checksum_dst(dst_flt), "_mm256_i32gather_ps");
+
+  // Benchmarks end:
+  printf("]}\n");
+}
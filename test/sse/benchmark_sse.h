@@ -26,14 +26,16 @@
 #define aligned_alloc(align, size) _aligned_malloc((size), (align))
 #endif
 
+#ifdef __SSE__
 // Scalar horizonal max across four lanes.
 float hmax(__m128 m) {
   float f[4];
   _mm_storeu_ps(f, m);
   return fmax(fmax(f[0], f[1]), fmax(f[2], f[3]));
 }
+#endif
 
-#include "../tick.h"
+#include "../benchmark/tick.h"
 
 const int N = 8*1024*1024;
 
@@ -66,12 +68,14 @@ bool comma=false;
     printf("%s", (result) != 0 ? "Error!" : ""); \
   } while(0)
 
+#ifdef __SSE__
 void Print(__m128 m)
 {
   float val[4];
   _mm_storeu_ps(val, m);
   fprintf(stderr, "[%g, %g, %g, %g]\n", val[3], val[2], val[1], val[0]);
 }
+#endif
 
 bool always_true() { return time(NULL) != 0; } // This function always returns true, but the compiler should not know this.
 
@@ -83,10 +87,11 @@ bool always_true() { return time(NULL) != 0; } // This function always returns t
 #define INLINE __inline__
 #endif
 
-// Slightly awkward way to allocate so that compiler will definitely not see this memory area as compile-time optimizable:
-int NOINLINE *alloc_int_buffer() { return always_true() ? (int*)aligned_alloc(16, (N+16)*sizeof(int)) : 0; }
-float NOINLINE *alloc_float_buffer() { return always_true() ? (float*)aligned_alloc(16, (N+16)*sizeof(float)) : 0; }
-double NOINLINE *alloc_double_buffer() { return always_true() ? (double*)aligned_alloc(16, (N+16)*sizeof(double)) : 0; }
+// Slightly awkward way to allocate so that compiler will definitely not see this memory area as compile-time optimizable.
+// Buffers are 32-byte aligned so that the 256-bit AVX loads and stores can use them too.
+int NOINLINE *alloc_int_buffer() { return always_true() ? (int*)aligned_alloc(32, (N+16)*sizeof(int)) : 0; }
+float NOINLINE *alloc_float_buffer() { return always_true() ? (float*)aligned_alloc(32, (N+16)*sizeof(float)) : 0; }
+double NOINLINE *alloc_double_buffer() { return always_true() ? (double*)aligned_alloc(32, (N+16)*sizeof(double)) : 0; }
 
 template<typename T>
 T checksum_dst(T *dst) {
@@ -209,6 +214,73 @@ double ucastd(uint64_t t) { return *(double*)&t; }
     _mm_store_pd(dst_dbl, o0); \
   END(checksum_dst(dst_dbl), msg);
 
+#ifdef __AVX__
+
+#define LOAD_STORE_256_F(msg, load_instr, load_offset, store_instr, store_offset) \
+  START(); \
+    for(int i = 0; i < N; i += 8) \
+      store_instr(dst_flt+store_offset+i, load_instr(src_flt+load_offset+i)); \
+  END(checksum_dst(dst_flt), msg);
+
+#define LOAD_STORE_256_I(msg, load_instr, load_offset, store_instr, store_offset) \
+  START(); \
+    for(int i = 0; i < N; i += 8) \
+      store_instr((__m256i*)(dst_int+store_offset+i), load_instr((__m256i*)(src_int+load_offset+i))); \
+  END(checksum_dst(dst_int), msg);
+
+#define UNARYOP_256_F_F(msg, instr, op0) \
+  START(); \
+    __m256 o = op0; \
+    for(int i = 0; i < N; i += 8) \
+      o = instr(o); \
+    _mm256_store_ps(dst_flt, o); \
+  END(checksum_dst(dst_flt), msg);
+
+#define UNARYOP_256_I_I(msg, instr, op0) \
+  START(); \
+    __m256i o = op0; \
+    for(int i = 0; i < N; i += 8) \
+      o = instr(o); \
+    _mm256_store_si256((__m256i*)dst_int, o); \
+  END(checksum_dst(dst_int), msg);
+
+#define UNARYOP_256_D_D(msg, instr, op0) \
+  START(); \
+    __m256d o = op0; \
+    for(int i = 0; i < N; i += 4) \
+      o = instr(o); \
+    _mm256_store_pd(dst_dbl, o); \
+  END(checksum_dst(dst_dbl), msg);
+
+#define BINARYOP_256_F_FF(msg, instr, op0, op1) \
+  START(); \
+    __m256 o0 = op0; \
+    __m256 o1 = op1; \
+    for(int i = 0; i < N; i += 8) \
+      o0 = instr(o0, o1); \
+    _mm256_store_ps(dst_flt, o0); \
+  END(checksum_dst(dst_flt), msg);
+
+#define BINARYOP_256_I_II(msg, instr, op0, op1) \
+  START(); \
+    __m256i o0 = op0; \
+    __m256i o1 = op1; \
+    for(int i = 0; i < N; i += 8) \
+      o0 = instr(o0, o1); \
+    _mm256_store_si256((__m256i*)dst_int, o0); \
+  END(checksum_dst(dst_int), msg);
+
+#define BINARYOP_256_D_DD(msg, instr, op0, op1) \
+  START(); \
+    __m256d o0 = op0; \
+    __m256d o1 = op1; \
+    for(int i = 0; i < N; i += 4) \
+      o0 = instr(o0, o1); \
+    _mm256_store_pd(dst_dbl, o0); \
+  END(checksum_dst(dst_dbl), msg);
+
+#endif // __AVX__
+
 #define Max(a,b) ((a) >= (b) ? (a) : (b))
 #define Min(a,b) ((a) <= (b) ? (a) : (b))
 
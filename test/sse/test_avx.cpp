@@ -43,4 +43,79 @@ int main() {
   Ret_M128_M128(int, _mm_testnzc_ps);
   Ret_M128d_M128d(int, _mm_testz_pd);
   Ret_M128_M128(int, _mm_testz_ps);
+
+  // 256-bit operations
+  Ret_M256d_M256d(__m256d, _mm256_add_pd);
+  Ret_M256_M256(__m256, _mm256_add_ps);
+  Ret_M256d_M256d(__m256d, _mm256_addsub_pd);
+  Ret_M256_M256(__m256, _mm256_addsub_ps);
+  Ret_M256d_M256d(__m256d, _mm256_and_pd);
+  Ret_M256_M256(__m256, _mm256_and_ps);
+  Ret_M256d_M256d(__m256d, _mm256_andnot_pd);
+  Ret_M256_M256(__m256, _mm256_andnot_ps);
+  Ret_M256d_M256d_Tint(__m256d, _mm256_blend_pd);
+  Ret_M256_M256_Tint(__m256, _mm256_blend_ps);
+  Ret_M256d_M256d_M256d(__m256d, _mm256_blendv_pd);
+  Ret_M256_M256_M256(__m256, _mm256_blendv_ps);
+  Ret_M256d(__m256d, _mm256_ceil_pd);
+  Ret_M256(__m256, _mm256_ceil_ps);
+  Ret_M256d_M256d_Tint_5bits(__m256d, _mm256_cmp_pd);
+  Ret_M256_M256_Tint_5bits(__m256, _mm256_cmp_ps);
+  Ret_M128i(__m256d, _mm256_cvtepi32_pd);
+  Ret_M256i(__m256, _mm256_cvtepi32_ps);
+  Ret_M256d(__m128i, _mm256_cvtpd_epi32);
+  Ret_M256d(__m128, _mm256_cvtpd_ps);
+  Ret_M256(__m256i, _mm256_cvtps_epi32);
+  Ret_M128(__m256d, _mm256_cvtps_pd);
+  Ret_M256d(__m128i, _mm256_cvttpd_epi32);
+  Ret_M256(__m256i, _mm256_cvttps_epi32);
+  Ret_M256d_M256d(__m256d, _mm256_div_pd);
+  Ret_M256_M256(__m256, _mm256_div_ps);
+  Ret_M256_M256_Tint(__m256, _mm256_dp_ps);
+  Ret_M256d(__m256d, _mm256_floor_pd);
+  Ret_M256(__m256, _mm256_floor_ps);
+  Ret_M256d_M256d(__m256d, _mm256_hadd_pd);
+  Ret_M256_M256(__m256, _mm256_hadd_ps);
+  Ret_M256d_M256d(__m256d, _mm256_hsub_pd);
+  Ret_M256_M256(__m256, _mm256_hsub_ps);
+  Ret_M256d_M256d(__m256d, _mm256_max_pd);
+  Ret_M256_M256(__m256, _mm256_max_ps);
+  Ret_M256d_M256d(__m256d, _mm256_min_pd);
+  Ret_M256_M256(__m256, _mm256_min_ps);
+  Ret_M256d(__m256d, _mm256_movedup_pd);
+  Ret_M256(__m256, _mm256_movehdup_ps);
+  Ret_M256(__m256, _mm256_moveldup_ps);
+  Ret_M256d(int, _mm256_movemask_pd);
+  Ret_M256(int, _mm256_movemask_ps);
+  Ret_M256d_M256d(__m256d, _mm256_mul_pd);
+  Ret_M256_M256(__m256, _mm256_mul_ps);
+  Ret_M256d_M256d(__m256d, _mm256_or_pd);
+  Ret_M256_M256(__m256, _mm256_or_ps);
+  Ret_M256d_M256d_Tint(__m256d, _mm256_permute2f128_pd);
+  Ret_M256_M256_Tint(__m256, _mm256_permute2f128_ps);
+  Ret_M256d_Tint(__m256d, _mm256_permute_pd);
+  Ret_M256_Tint(__m256, _mm256_permute_ps);
+  Ret_M256d_M256i(__m256d, _mm256_permutevar_pd);
+  Ret_M256_M256i(__m256, _mm256_permutevar_ps);
+  Ret_M256d_M256d_Tint(__m256d, _mm256_shuffle_pd);
+  Ret_M256_M256_Tint(__m256, _mm256_shuffle_ps);
+  Ret_M256d(__m256d, _mm256_sqrt_pd);
+  Ret_M256(__m256, _mm256_sqrt_ps);
+  Ret_M256d_M256d(__m256d, _mm256_sub_pd);
+  Ret_M256_M256(__m256, _mm256_sub_ps);
+  Ret_M256d_M256d(int, _mm256_testc_pd);
+  Ret_M256_M256(int, _mm256_testc_ps);
+  Ret_M256i_M256i(int, _mm256_testc_si256);
+  Ret_M256d_M256d(int, _mm256_testnzc_pd);
+  Ret_M256_M256(int, _mm256_testnzc_ps);
+  Ret_M256i_M256i(int, _mm256_testnzc_si256);
+  Ret_M256d_M256d(int, _mm256_testz_pd);
+  Ret_M256_M256(int, _mm256_testz_ps);
+  Ret_M256i_M256i(int, _mm256_testz_si256);
+  Ret_M256d_M256d(__m256d, _mm256_unpackhi_pd);
+  Ret_M256_M256(__m256, _mm256_unpackhi_ps);
+  Ret_M256d_M256d(__m256d, _mm256_unpacklo_pd);
+  Ret_M256_M256(__m256, _mm256_unpacklo_ps);
+  Ret_M256d_M256d(__m256d, _mm256_xor_pd);
+  Ret_M256_M256(__m256, _mm256_xor_ps);
 }
@@ -0,0 +1,241 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+// This file uses AVX2 by calling different functions with different interesting inputs and prints the results.
+// Use a diff tool to compare the results between platforms.
+
+#include <immintrin.h>
+#include "test_sse.h"
+
+bool testNaNBits = true;
+
+float *interesting_floats = get_interesting_floats();
+int numInterestingFloats = sizeof(interesting_floats_)/sizeof(interesting_floats_[0]);
+uint32_t *interesting_ints = get_interesting_ints();
+int numInterestingInts = sizeof(interesting_ints_)/sizeof(interesting_ints_[0]);
+double *interesting_doubles = get_interesting_doubles();
+int numInterestingDoubles = sizeof(interesting_doubles_)/sizeof(interesting_doubles_[0]);
+
+#define Print_Idx_Mask(func, idx, mask, ret) \
+  { \
+    char str[512]; tostr(&idx, str); \
+    char str2[512]; tostr(&mask, str2); \
+    char str3[512]; tostr(&ret, str3); \
+    printf("%s(%s, %s) = %s\n", #func, str, str2, str3); \
+  }
+
+// Gathers and masked loads read from the interesting arrays with indices
+// masked down to stay within their bounds.
+void test_gathers() {
+  const int *ints = (const int *)interesting_ints;
+  const long long *int64s = (const long long *)interesting_ints;
+  for(int i = 0; i < numInterestingInts / 4; ++i)
+    for(int j = 0; j < numInterestingInts / 4; ++j)
+    {
+      __m128i idx = _mm_and_si128(_mm_castps_si128(E1_Int(interesting_ints, i*4, numInterestingInts)), _mm_set1_epi32(15));
+      __m256i idx256 = _mm256_and_si256(E1_256i(interesting_ints, i*4, numInterestingInts), _mm256_set1_epi32(15));
+      __m128i idx64 = _mm_cvtepi32_epi64(idx);
+      __m256i idx64_256 = _mm256_cvtepi32_epi64(idx);
+      __m128i mask = _mm_castps_si128(E2_Int(interesting_ints, j*4, numInterestingInts));
+      __m256i mask256 = E2_256i(interesting_ints, j*4, numInterestingInts);
+      __m128i src = _mm_set1_epi32(0x5A5A5A5A);
+      __m256i src256 = _mm256_set1_epi32(0x5A5A5A5A);
+
+      __m128i r = _mm_i32gather_epi32(ints, idx, 4); Print_Idx_Mask(_mm_i32gather_epi32, idx, mask, r);
+      r = _mm_mask_i32gather_epi32(src, ints, idx, mask, 4); Print_Idx_Mask(_mm_mask_i32gather_epi32, idx, mask, r);
+      r = _mm_i32gather_epi64(int64s, idx, 8); Print_Idx_Mask(_mm_i32gather_epi64, idx, mask, r);
+      r = _mm_mask_i32gather_epi64(src, int64s, idx, mask, 8); Print_Idx_Mask(_mm_mask_i32gather_epi64, idx, mask, r);
+      r = _mm_i64gather_epi32(ints, idx64, 4); Print_Idx_Mask(_mm_i64gather_epi32, idx64, mask, r);
+      r = _mm_mask_i64gather_epi32(src, ints, idx64, mask, 4); Print_Idx_Mask(_mm_mask_i64gather_epi32, idx64, mask, r);
+      r = _mm_i64gather_epi64(int64s, idx64, 8); Print_Idx_Mask(_mm_i64gather_epi64, idx64, mask, r);
+      r = _mm_mask_i64gather_epi64(src, int64s, idx64, mask, 8); Print_Idx_Mask(_mm_mask_i64gather_epi64, idx64, mask, r);
+      r = _mm256_i64gather_epi32(ints, idx64_256, 2); Print_Idx_Mask(_mm256_i64gather_epi32, idx64_256, mask, r);
+      r = _mm256_mask_i64gather_epi32(src, ints, idx64_256, mask, 2); Print_Idx_Mask(_mm256_mask_i64gather_epi32, idx64_256, mask, r);
+
+      __m256i r256 = _mm256_i32gather_epi32(ints, idx256, 4); Print_Idx_Mask(_mm256_i32gather_epi32, idx256, mask256, r256);
+      r256 = _mm256_mask_i32gather_epi32(src256, ints, idx256, mask256, 4); Print_Idx_Mask(_mm256_mask_i32gather_epi32, idx256, mask256, r256);
+      r256 = _mm256_i32gather_epi64(int64s, idx, 8); Print_Idx_Mask(_mm256_i32gather_epi64, idx, mask256, r256);
+      r256 = _mm256_mask_i32gather_epi64(src256, int64s, idx, mask256, 8); Print_Idx_Mask(_mm256_mask_i32gather_epi64, idx, mask256, r256);
+      r256 = _mm256_i64gather_epi64(int64s, idx64_256, 1); Print_Idx_Mask(_mm256_i64gather_epi64, idx64_256, mask256, r256);
+      r256 = _mm256_mask_i64gather_epi64(src256, int64s, idx64_256, mask256, 1); Print_Idx_Mask(_mm256_mask_i64gather_epi64, idx64_256, mask256, r256);
+
+      __m128 rf = _mm_i32gather_ps(interesting_floats, idx, 4); Print_Idx_Mask(_mm_i32gather_ps, idx, mask, rf);
+      rf = _mm_mask_i32gather_ps(_mm_castsi128_ps(src), interesting_floats, idx, _mm_castsi128_ps(mask), 4); Print_Idx_Mask(_mm_mask_i32gather_ps, idx, mask, rf);
+      rf = _mm_i64gather_ps(interesting_floats, idx64, 4); Print_Idx_Mask(_mm_i64gather_ps, idx64, mask, rf);
+      rf = _mm256_i64gather_ps(interesting_floats, idx64_256, 4); Print_Idx_Mask(_mm256_i64gather_ps, idx64_256, mask, rf);
+      __m256 rf256 = _mm256_mask_i32gather_ps(_mm256_castsi256_ps(src256), interesting_floats, idx256, _mm256_castsi256_ps(mask256), 4); Print_Idx_Mask(_mm256_mask_i32gather_ps, idx256, mask256, rf256);
+      __m128d rd = _mm_i32gather_pd(interesting_doubles, idx, 8); Print_Idx_Mask(_mm_i32gather_pd, idx, mask, rd);
+      rd = _mm_mask_i64gather_pd(_mm_castsi128_pd(src), interesting_doubles, idx64, _mm_castsi128_pd(mask), 8); Print_Idx_Mask(_mm_mask_i64gather_pd, idx64, mask, rd);
+      __m256d rd256 = _mm256_mask_i32gather_pd(_mm256_castsi256_pd(src256), interesting_doubles, idx, _mm256_castsi256_pd(mask256), 8); Print_Idx_Mask(_mm256_mask_i32gather_pd, idx, mask256, rd256);
+      rd256 = _mm256_i64gather_pd(interesting_doubles, idx64_256, 8); Print_Idx_Mask(_mm256_i64gather_pd, idx64_256, mask256, rd256);
+
+      alignas(32) int data[8];
+      memcpy(data, ints + i, sizeof(data));
+      r = _mm_maskload_epi32(data, mask); Print_Idx_Mask(_mm_maskload_epi32, idx, mask, r);
+      r = _mm_maskload_epi64((const long long *)data, mask); Print_Idx_Mask(_mm_maskload_epi64, idx, mask, r);
+      r256 = _mm256_maskload_epi32(data, mask256); Print_Idx_Mask(_mm256_maskload_epi32, idx, mask256, r256);
+      r256 = _mm256_maskload_epi64((const long long *)data, mask256); Print_Idx_Mask(_mm256_maskload_epi64, idx, mask256, r256);
+
+      alignas(32) int out[8] = {0};
+      _mm256_maskstore_epi32(out, mask256, idx256);
+      r256 = _mm256_loadu_si256((__m256i *)out); Print_Idx_Mask(_mm256_maskstore_epi32, idx256, mask256, r256);
+      _mm_maskstore_epi64((long long *)out, mask, idx64);
+      r = _mm_loadu_si128((__m128i *)out); Print_Idx_Mask(_mm_maskstore_epi64, idx64, mask, r);
+    }
+}
+
+int main() {
+  assert(numInterestingFloats % 4 == 0);
+  assert(numInterestingInts % 4 == 0);
+  assert(numInterestingDoubles % 4 == 0);
+
+  Ret_M256i(__m256i, _mm256_abs_epi8);
+  Ret_M256i(__m256i, _mm256_abs_epi16);
+  Ret_M256i(__m256i, _mm256_abs_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_add_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_add_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_add_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_add_epi64);
+  Ret_M256i_M256i(__m256i, _mm256_adds_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_adds_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_adds_epu8);
+  Ret_M256i_M256i(__m256i, _mm256_adds_epu16);
+  Ret_M256i_M256i_Tint(__m256i, _mm256_alignr_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_and_si256);
+  Ret_M256i_M256i(__m256i, _mm256_andnot_si256);
+  Ret_M256i_M256i(__m256i, _mm256_avg_epu8);
+  Ret_M256i_M256i(__m256i, _mm256_avg_epu16);
+  Ret_M256i_M256i_Tint(__m256i, _mm256_blend_epi16);
+  Ret_M128i_M128i_Tint(__m128i, _mm_blend_epi32);
+  Ret_M256i_M256i_Tint(__m256i, _mm256_blend_epi32);
+  Ret_M256i_M256i_M256i(__m256i, _mm256_blendv_epi8);
+  Ret_M128i(__m128i, _mm_broadcastb_epi8);
+  Ret_M128i(__m128i, _mm_broadcastw_epi16);
+  Ret_M128i(__m128i, _mm_broadcastd_epi32);
+  Ret_M128i(__m128i, _mm_broadcastq_epi64);
+  Ret_M128(__m128, _mm_broadcastss_ps);
+  Ret_M128d(__m128d, _mm_broadcastsd_pd);
+  Ret_M128i(__m256i, _mm256_broadcastb_epi8);
+  Ret_M128i(__m256i, _mm256_broadcastw_epi16);
+  Ret_M128i(__m256i, _mm256_broadcastd_epi32);
+  Ret_M128i(__m256i, _mm256_broadcastq_epi64);
+  Ret_M128(__m256, _mm256_broadcastss_ps);
+  Ret_M128d(__m256d, _mm256_broadcastsd_pd);
+  Ret_M128i(__m256i, _mm256_broadcastsi128_si256);
+  Ret_M256i_Tint(__m256i, _mm256_bslli_epi128);
+  Ret_M256i_Tint(__m256i, _mm256_bsrli_epi128);
+  Ret_M256i_M256i(__m256i, _mm256_cmpeq_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_cmpeq_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_cmpeq_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_cmpeq_epi64);
+  Ret_M256i_M256i(__m256i, _mm256_cmpgt_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_cmpgt_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_cmpgt_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_cmpgt_epi64);
+  Ret_M128i(__m256i, _mm256_cvtepi8_epi16);
+  Ret_M128i(__m256i, _mm256_cvtepi8_epi32);
+  Ret_M128i(__m256i, _mm256_cvtepi8_epi64);
+  Ret_M128i(__m256i, _mm256_cvtepi16_epi32);
+  Ret_M128i(__m256i, _mm256_cvtepi16_epi64);
+  Ret_M128i(__m256i, _mm256_cvtepi32_epi64);
+  Ret_M128i(__m256i, _mm256_cvtepu8_epi16);
+  Ret_M128i(__m256i, _mm256_cvtepu8_epi32);
+  Ret_M128i(__m256i, _mm256_cvtepu8_epi64);
+  Ret_M128i(__m256i, _mm256_cvtepu16_epi32);
+  Ret_M128i(__m256i, _mm256_cvtepu16_epi64);
+  Ret_M128i(__m256i, _mm256_cvtepu32_epi64);
+  Ret_M256i_M256i(__m256i, _mm256_hadd_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_hadd_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_hadds_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_hsub_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_hsub_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_hsubs_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_madd_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_maddubs_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_max_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_max_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_max_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_max_epu8);
+  Ret_M256i_M256i(__m256i, _mm256_max_epu16);
+  Ret_M256i_M256i(__m256i, _mm256_max_epu32);
+  Ret_M256i_M256i(__m256i, _mm256_min_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_min_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_min_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_min_epu8);
+  Ret_M256i_M256i(__m256i, _mm256_min_epu16);
+  Ret_M256i_M256i(__m256i, _mm256_min_epu32);
+  Ret_M256i(int, _mm256_movemask_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_mul_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_mul_epu32);
+  Ret_M256i_M256i(__m256i, _mm256_mulhi_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_mulhi_epu16);
+  Ret_M256i_M256i(__m256i, _mm256_mulhrs_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_mullo_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_mullo_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_or_si256);
+  Ret_M256i_M256i(__m256i, _mm256_packs_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_packs_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_packus_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_packus_epi32);
+  Ret_M256i_M256i_Tint(__m256i, _mm256_permute2x128_si256);
+  Ret_M256i_Tint(__m256i, _mm256_permute4x64_epi64);
+  Ret_M256d_Tint(__m256d, _mm256_permute4x64_pd);
+  Ret_M256i_M256i(__m256i, _mm256_permutevar8x32_epi32);
+  Ret_M256_M256i(__m256, _mm256_permutevar8x32_ps);
+  Ret_M256i_M256i(__m256i, _mm256_sad_epu8);
+  Ret_M256i_M256i(__m256i, _mm256_shuffle_epi8);
+  Ret_M256i_Tint(__m256i, _mm256_shuffle_epi32);
+  Ret_M256i_Tint(__m256i, _mm256_shufflehi_epi16);
+  Ret_M256i_Tint(__m256i, _mm256_shufflelo_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_sign_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_sign_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_sign_epi32);
+  Ret_M256i_M128i(__m256i, _mm256_sll_epi16);
+  Ret_M256i_M128i(__m256i, _mm256_sll_epi32);
+  Ret_M256i_M128i(__m256i, _mm256_sll_epi64);
+  Ret_M256i_Tint(__m256i, _mm256_slli_epi16);
+  Ret_M256i_Tint(__m256i, _mm256_slli_epi32);
+  Ret_M256i_Tint(__m256i, _mm256_slli_epi64);
+  Ret_M128i_M128i(__m128i, _mm_sllv_epi32);
+  Ret_M128i_M128i(__m128i, _mm_sllv_epi64);
+  Ret_M256i_M256i(__m256i, _mm256_sllv_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_sllv_epi64);
+  Ret_M256i_M128i(__m256i, _mm256_sra_epi16);
+  Ret_M256i_M128i(__m256i, _mm256_sra_epi32);
+  Ret_M256i_Tint(__m256i, _mm256_srai_epi16);
+  Ret_M256i_Tint(__m256i, _mm256_srai_epi32);
+  Ret_M128i_M128i(__m128i, _mm_srav_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_srav_epi32);
+  Ret_M256i_M128i(__m256i, _mm256_srl_epi16);
+  Ret_M256i_M128i(__m256i, _mm256_srl_epi32);
+  Ret_M256i_M128i(__m256i, _mm256_srl_epi64);
+  Ret_M256i_Tint(__m256i, _mm256_srli_epi16);
+  Ret_M256i_Tint(__m256i, _mm256_srli_epi32);
+  Ret_M256i_Tint(__m256i, _mm256_srli_epi64);
+  Ret_M128i_M128i(__m128i, _mm_srlv_epi32);
+  Ret_M128i_M128i(__m128i, _mm_srlv_epi64);
+  Ret_M256i_M256i(__m256i, _mm256_srlv_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_srlv_epi64);
+  Ret_M256i_M256i(__m256i, _mm256_sub_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_sub_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_sub_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_sub_epi64);
+  Ret_M256i_M256i(__m256i, _mm256_subs_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_subs_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_subs_epu8);
+  Ret_M256i_M256i(__m256i, _mm256_subs_epu16);
+  Ret_M256i_M256i(__m256i, _mm256_unpackhi_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_unpackhi_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_unpackhi_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_unpackhi_epi64);
+  Ret_M256i_M256i(__m256i, _mm256_unpacklo_epi8);
+  Ret_M256i_M256i(__m256i, _mm256_unpacklo_epi16);
+  Ret_M256i_M256i(__m256i, _mm256_unpacklo_epi32);
+  Ret_M256i_M256i(__m256i, _mm256_unpacklo_epi64);
+  Ret_M256i_M256i(__m256i, _mm256_xor_si256);
+
+  test_gathers();
+}
@@ -933,3 +933,148 @@ double *getTempOutDoubleStore(int alignmentBytes) { return (double*)getTempOutFl
         char str3[256]; tostr(&ret, str3); \
         printf("%s(%s, %s) = %s\n", #func, str, str2, str3); \
       }
+
+#ifdef __AVX__
+
+void tostr(__m256 *m, char *outstr) {
+  __m128 lo = _mm256_castps256_ps128(*m), hi = _mm256_extractf128_ps(*m, 1);
+  char s[2][256];
+  tostr(&lo, s[0]);
+  tostr(&hi, s[1]);
+  sprintf(outstr, "[%s,%s]", s[1], s[0]);
+}
+
+void tostr(__m256d *m, char *outstr) {
+  __m128d lo = _mm256_castpd256_pd128(*m), hi = _mm256_extractf128_pd(*m, 1);
+  char s[2][256];
+  tostr(&lo, s[0]);
+  tostr(&hi, s[1]);
+  sprintf(outstr, "[%s,%s]", s[1], s[0]);
+}
+
+void tostr(__m256i *m, char *outstr) {
+  __m128i lo = _mm256_castsi256_si128(*m), hi = _mm256_extractf128_si256(*m, 1);
+  char s[2][256];
+  tostr(&lo, s[0]);
+  tostr(&hi, s[1]);
+  sprintf(outstr, "[%s,%s]", s[1], s[0]);
+}
+
+// The upper half takes the next four (or two) elements so that both halves of
+// a 256-bit input differ.
+#define E1_256(arr, i, n) _mm256_set_m128(E2(arr, i+1, n), E1(arr, i, n))
+#define E2_256(arr, i, n) _mm256_set_m128(E1(arr, i+1, n), E2(arr, i, n))
+#define E1_256d(arr, i, n) _mm256_set_m128d(E2_Double(arr, i+1, n), E1_Double(arr, i, n))
+#define E2_256d(arr, i, n) _mm256_set_m128d(E1_Double(arr, i+1, n), E2_Double(arr, i, n))
+#define E1_256i(arr, i, n) _mm256_castps_si256(_mm256_set_m128(E2_Int(arr, i+1, n), E1_Int(arr, i, n)))
+#define E2_256i(arr, i, n) _mm256_castps_si256(_mm256_set_m128(E1_Int(arr, i+1, n), E2_Int(arr, i, n)))
+
+#define Ret_M256_body(Ret_type, func, Elem, E, arr, num, lanes) \
+  for(int i = 0; i < num / lanes; ++i) \
+    for(int k = 0; k < lanes; ++k) \
+    { \
+      Elem m1 = E(arr, i*lanes+k, num); \
+      Ret_type ret = func(m1); \
+      char str[512]; tostr(&m1, str); \
+      char str2[512]; tostr(&ret, str2); \
+      printf("%s(%s) = %s\n", #func, str, str2); \
+    }
+
+#define Ret_M256_M256_body(Ret_type, func, Elem, Elem2, E, E_2, arr, num, lanes, arr2, num2, lanes2) \
+  for(int i = 0; i < num / lanes; ++i) \
+    for(int k = 0; k < lanes; ++k) \
+      for(int j = 0; j < num2 / lanes2; ++j) \
+      { \
+        Elem m1 = E(arr, i*lanes+k, num); \
+        Elem2 m2 = E_2(arr2, j*lanes2, num2); \
+        Ret_type ret = func(m1, m2); \
+        char str[512]; tostr(&m1, str); \
+        char str2[512]; tostr(&m2, str2); \
+        char str3[512]; tostr(&ret, str3); \
+        printf("%s(%s, %s) = %s\n", #func, str, str2, str3); \
+      }
+
+#define Ret_M256_M256_M256_body(Ret_type, func, Elem, E, E_2, arr, num, lanes) \
+  for(int i = 0; i < num / lanes; ++i) \
+    for(int k = 0; k < lanes; ++k) \
+      for(int j = 0; j < num / lanes; ++j) \
+      { \
+        Elem m1 = E(arr, i*lanes+k, num); \
+        Elem m2 = E_2(arr, j*lanes, num); \
+        Elem m3 = E(arr, (i+j)*lanes, num); \
+        Ret_type ret = func(m1, m2, m3); \
+        char str[512]; tostr(&m1, str); \
+        char str2[512]; tostr(&m2, str2); \
+        char str3[512]; tostr(&m3, str3); \
+        char str4[512]; tostr(&ret, str4); \
+        printf("%s(%s, %s, %s) = %s\n", #func, str, str2, str3, str4); \
+      }
+
+#define Ret_M256(Ret_type, func) Ret_M256_body(Ret_type, func, __m256, E1_256, interesting_floats, numInterestingFloats, 4)
+#define Ret_M256d(Ret_type, func) Ret_M256_body(Ret_type, func, __m256d, E1_256d, interesting_doubles, numInterestingDoubles, 2)
+#define Ret_M256i(Ret_type, func) Ret_M256_body(Ret_type, func, __m256i, E1_256i, interesting_ints, numInterestingInts, 4)
+
+#define Ret_M256_M256(Ret_type, func) \
+  Ret_M256_M256_body(Ret_type, func, __m256, __m256, E1_256, E2_256, interesting_floats, numInterestingFloats, 4, interesting_floats, numInterestingFloats, 4)
+#define Ret_M256d_M256d(Ret_type, func) \
+  Ret_M256_M256_body(Ret_type, func, __m256d, __m256d, E1_256d, E2_256d, interesting_doubles, numInterestingDoubles, 2, interesting_doubles, numInterestingDoubles, 2)
+#define Ret_M256i_M256i(Ret_type, func) \
+  Ret_M256_M256_body(Ret_type, func, __m256i, __m256i, E1_256i, E2_256i, interesting_ints, numInterestingInts, 4, interesting_ints, numInterestingInts, 4)
+#define Ret_M256_M256i(Ret_type, func) \
+  Ret_M256_M256_body(Ret_type, func, __m256, __m256i, E1_256, E2_256i, interesting_floats, numInterestingFloats, 4, interesting_ints, numInterestingInts, 4)
+#define Ret_M256d_M256i(Ret_type, func) \
+  Ret_M256_M256_body(Ret_type, func, __m256d, __m256i, E1_256d, E2_256i, interesting_doubles, numInterestingDoubles, 2, interesting_ints, numInterestingInts, 4)
+#define Ret_M256i_M128i(Ret_type, func) \
+  Ret_M256_M256_body(Ret_type, func, __m256i, __m128i, E1_256i, E2_Int_M128i, interesting_ints, numInterestingInts, 4, interesting_ints, numInterestingInts, 4)
+
+#define Ret_M256_M256_M256(Ret_type, func) Ret_M256_M256_M256_body(Ret_type, func, __m256, E1_256, E2_256, interesting_floats, numInterestingFloats, 4)
+#define Ret_M256d_M256d_M256d(Ret_type, func) Ret_M256_M256_M256_body(Ret_type, func, __m256d, E1_256d, E2_256d, interesting_doubles, numInterestingDoubles, 2)
+#define Ret_M256i_M256i_M256i(Ret_type, func) Ret_M256_M256_M256_body(Ret_type, func, __m256i, E1_256i, E2_256i, interesting_ints, numInterestingInts, 4)
+
+#define E2_Int_M128i(arr, i, n) _mm_castps_si128(E2_Int(arr, i, n))
+
+#define Ret_M256_Tint_body_(Ret_type, func, Tint, Elem, E, arr, num, lanes) \
+  for(int i = 0; i < num / lanes; ++i) \
+    for(int k = 0; k < lanes; ++k) \
+    { \
+      Elem m1 = E(arr, i*lanes+k, num); \
+      Ret_type ret = func(m1, Tint); \
+      char str[512]; tostr(&m1, str); \
+      char str2[512]; tostr(&ret, str2); \
+      printf("%s(%s, %d) = %s\n", #func, str, Tint, str2); \
+    }
+
+#define Ret_M256_M256_Tint_body_(Ret_type, func, Tint, Elem, E, E_2, arr, num, lanes) \
+  for(int i = 0; i < num / lanes; ++i) \
+    for(int k = 0; k < lanes; ++k) \
+      for(int j = 0; j < num / lanes; ++j) \
+      { \
+        Elem m1 = E(arr, i*lanes+k, num); \
+        Elem m2 = E_2(arr, j*lanes, num); \
+        Ret_type ret = func(m1, m2, Tint); \
+        char str[512]; tostr(&m1, str); \
+        char str2[512]; tostr(&m2, str2); \
+        char str3[512]; tostr(&ret, str3); \
+        printf("%s(%s, %s, %d) = %s\n", #func, str, str2, Tint, str3); \
+      }
+
+#define Ret_M256_Tint_body(Ret_type, func, Tint) Ret_M256_Tint_body_(Ret_type, func, Tint, __m256, E1_256, interesting_floats, numInterestingFloats, 4)
+#define Ret_M256d_Tint_body(Ret_type, func, Tint) Ret_M256_Tint_body_(Ret_type, func, Tint, __m256d, E1_256d, interesting_doubles, numInterestingDoubles, 2)
+#define Ret_M256i_Tint_body(Ret_type, func, Tint) Ret_M256_Tint_body_(Ret_type, func, Tint, __m256i, E1_256i, interesting_ints, numInterestingInts, 4)
+#define Ret_M256_M256_Tint_body(Ret_type, func, Tint) \
+  Ret_M256_M256_Tint_body_(Ret_type, func, Tint, __m256, E1_256, E2_256, interesting_floats, numInterestingFloats, 4)
+#define Ret_M256d_M256d_Tint_body(Ret_type, func, Tint) \
+  Ret_M256_M256_Tint_body_(Ret_type, func, Tint, __m256d, E1_256d, E2_256d, interesting_doubles, numInterestingDoubles, 2)
+#define Ret_M256i_M256i_Tint_body(Ret_type, func, Tint) \
+  Ret_M256_M256_Tint_body_(Ret_type, func, Tint, __m256i, E1_256i, E2_256i, interesting_ints, numInterestingInts, 4)
+
+#define Ret_M256_Tint(Ret_type, func) const_int8_unroll(Ret_type, Ret_M256_Tint_body, func)
+#define Ret_M256d_Tint(Ret_type, func) const_int8_unroll(Ret_type, Ret_M256d_Tint_body, func)
+#define Ret_M256i_Tint(Ret_type, func) const_int8_unroll(Ret_type, Ret_M256i_Tint_body, func)
+#define Ret_M256_M256_Tint(Ret_type, func) const_int8_unroll(Ret_type, Ret_M256_M256_Tint_body, func)
+#define Ret_M256d_M256d_Tint(Ret_type, func) const_int8_unroll(Ret_type, Ret_M256d_M256d_Tint_body, func)
+#define Ret_M256i_M256i_Tint(Ret_type, func) const_int8_unroll(Ret_type, Ret_M256i_M256i_Tint_body, func)
+#define Ret_M256_M256_Tint_5bits(Ret_type, func) const_int5_full_unroll(Ret_type, Ret_M256_M256_Tint_body, func)
+#define Ret_M256d_M256d_Tint_5bits(Ret_type, func) const_int5_full_unroll(Ret_type, Ret_M256d_M256d_Tint_body, func)
+
+#endif
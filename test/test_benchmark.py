@@ -556,8 +556,7 @@ class benchmark(common.RunnerCore):
     '''
     self.do_benchmark('memops', src, 'final:')
 
-  @non_core
-  def test_files(self):
+  def do_files_benchmark(self, name, emcc_args):
     src = r'''
       #include <stdio.h>
       #include <stdlib.h>
@@ -598,7 +597,21 @@ class benchmark(common.RunnerCore):
         return 0;
       }
     '''
-    self.do_benchmark('files', src, 'ok', emcc_args=['-sFILESYSTEM', '-sMINIMAL_RUNTIME=0', '-sEXIT_RUNTIME'])
+    self.do_benchmark(name, src, 'ok', emcc_args=['-sFILESYSTEM', '-sMINIMAL_RUNTIME=0', '-sEXIT_RUNTIME'] + emcc_args)
+
+  @non_core
+  def test_files(self):
+    self.do_files_benchmark('files', [])
+
+  # The same I/O when JS heap accesses have to check for memory growth by
+  # another thread, and when GROWABLE_ARRAYBUFFERS makes that unnecessary.
+  @non_core
+  def test_files_pthread_growth(self):
+    self.do_files_benchmark('files_pthread_growth', ['-pthread', '-sALLOW_MEMORY_GROWTH', '-Wno-pthreads-mem-growth'])
+
+  @non_core
+  def test_files_growable_arraybuffers(self):
+    self.do_files_benchmark('files_growable_arraybuffers', ['-pthread', '-sALLOW_MEMORY_GROWTH', '-sGROWABLE_ARRAYBUFFERS'])
 
   def test_copy(self):
     src = r'''
@@ -935,6 +948,18 @@ class benchmark(common.RunnerCore):
       return float(re.search(r'Total time: ([\d\.]+)', output).group(1))
     self.do_benchmark('memcpy_16mb', read_file(test_file('benchmark/benchmark_memcpy.cpp')), 'Total time:', output_parser=output_parser, shared_args=['-DMIN_COPY=1048576', '-DBUILD_FOR_SHELL', '-I' + test_file('benchmark')])
 
+  @non_core
+  def test_string_128b(self):
+    def output_parser(output):
+      return float(re.search(r'Total time: ([\d\.]+)', output).group(1))
+    self.do_benchmark('string_128b', read_file(test_file('benchmark/benchmark_string.cpp')), 'Total time:', output_parser=output_parser, emcc_args=['-msimd128'], shared_args=['-DMAX_SIZE=128', '-I' + test_file('benchmark')])
+
+  @non_core
+  def test_string_1mb(self):
+    def output_parser(output):
+      return float(re.search(r'Total time: ([\d\.]+)', output).group(1))
+    self.do_benchmark('string_1mb', read_file(test_file('benchmark/benchmark_string.cpp')), 'Total time:', output_parser=output_parser, emcc_args=['-msimd128'], shared_args=['-DMIN_SIZE=256', '-I' + test_file('benchmark')])
+
   @non_core
   def test_memset_128b(self):
     def output_parser(output):
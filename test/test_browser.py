@@ -1271,6 +1271,8 @@ simulateKeyUp(100);
     '': ([],),
     'extra': (['-DEXTRA_WORK'],),
     'autopersist': (['-DIDBFS_AUTO_PERSIST'],),
+    'incremental': (['-DIDBFS_INCREMENTAL'],),
+    'incremental_autopersist': (['-DIDBFS_INCREMENTAL', '-DIDBFS_AUTO_PERSIST'],),
     'force_exit': (['-sEXIT_RUNTIME', '-DFORCE_EXIT'],),
   })
   def test_fs_idbfs_sync(self, args):
@@ -2705,6 +2707,9 @@ Module["preRun"] = () => {
   def test_html5_mouse(self, opts):
     self.btest('test_html5_mouse.c', args=opts + ['-DAUTOMATE_SUCCESS=1'], expected='0')
 
+  def test_html5_event_ring(self):
+    self.btest_exit('html5_event_ring.c', args=['-pthread', '-sPROXY_TO_PTHREAD'])
+
   @parameterized({
     '': ([],),
     'closure': (['-O2', '-g1', '--closure=1'],),
@@ -3832,6 +3837,11 @@ Module["preRun"] = () => {
   def test_pthread_proxying_in_futex_wait(self):
     self.btest_exit('pthread/test_pthread_proxying_in_futex_wait.cpp', args=['-O3', '-pthread', '-sPTHREAD_POOL_SIZE'])
 
+  # Test that a futex wait on the main thread can be woken while the main thread
+  # is in a nested futex wait, from a proxied call that it runs while waiting.
+  def test_pthread_futex_wait_nested(self):
+    self.btest_exit('pthread/test_futex_wait_nested.c', args=['-pthread', '-sPTHREAD_POOL_SIZE=2'])
+
   # Test that sbrk() operates properly in multithreaded conditions
   @no_2gb('uses INITIAL_MEMORY')
   @no_4gb('uses INITIAL_MEMORY')
@@ -4175,8 +4185,12 @@ Module["preRun"] = () => {
 
   # Tests that rendering from client side memory without default-enabling extensions works.
   @requires_graphics_hardware
-  def test_webgl_from_client_side_memory_without_default_enabled_extensions(self):
-    self.btest_exit('webgl_draw_triangle.c', args=['-lGL', '-sOFFSCREEN_FRAMEBUFFER', '-DEXPLICIT_SWAP=1', '-DDRAW_FROM_CLIENT_MEMORY=1', '-sFULL_ES2'])
+  @parameterized({
+    '': ([],),
+    'ring_buffer': (['-sGL_CLIENT_ARRAY_RING_BUFFER_SIZE=256'],),
+  })
+  def test_webgl_from_client_side_memory_without_default_enabled_extensions(self, args):
+    self.btest_exit('webgl_draw_triangle.c', args=args + ['-lGL', '-sOFFSCREEN_FRAMEBUFFER', '-DEXPLICIT_SWAP=1', '-DDRAW_FROM_CLIENT_MEMORY=1', '-sFULL_ES2'])
 
   # Tests for WEBGL_multi_draw extension
   # For testing WebGL draft extensions like this, if using chrome as the browser,
@@ -4595,6 +4609,14 @@ Module["preRun"] = () => {
     self.emcc_args.remove('-Werror')
     self.btest_exit('pthread/test_pthread_memory_growth.c', args=['-pthread', '-sPTHREAD_POOL_SIZE=2', '-sALLOW_MEMORY_GROWTH', '-sINITIAL_MEMORY=32MB', '-sMAXIMUM_MEMORY=256MB', '-g'] + emcc_args)
 
+  # Tests that strings and randomness work on memory grown by a pthread when the
+  # heap views are on a resizable buffer, which Web APIs do not accept.
+  @no_firefox('no WebAssembly.Memory.prototype.toResizableBuffer')
+  @no_2gb('uses INITIAL_MEMORY')
+  @no_4gb('uses INITIAL_MEMORY')
+  def test_pthread_growable_arraybuffers(self):
+    self.btest_exit('pthread/test_pthread_growable_arraybuffers.c', args=['-pthread', '-sPTHREAD_POOL_SIZE=1', '-sALLOW_MEMORY_GROWTH', '-sGROWABLE_ARRAYBUFFERS', '-sINITIAL_MEMORY=32MB', '-sMAXIMUM_MEMORY=256MB', '-sDEFAULT_LIBRARY_FUNCS_TO_INCLUDE=$UTF8ToString,$stringToUTF8'])
+
   # Tests that time in a pthread is relative to the main thread, so measurements
   # on different threads are still monotonic, as if checking a single central
   # clock.
@@ -5167,11 +5189,13 @@ Module["preRun"] = () => {
 
   @no_wasm64()
   @parameterized({
-    # the fetch backend works even on the main thread: we proxy to a background
-    # thread and busy-wait
-    # this test requires one thread per fetch backend, so updates to the test
-    # will require bumping this
+    # despite the name, main() runs on a pthread here as well, since the test
+    # always builds with PROXY_TO_PTHREAD.  this variant preallocates the pool:
+    # one thread for main() and the WASMFS_IO_THREADS (4) I/O threads that the
+    # backends share
     'main_thread': (['-sPTHREAD_POOL_SIZE=5'],),
+    # all the backends and files share a single I/O thread
+    'one_io_thread': (['-sPTHREAD_POOL_SIZE=2', '-sWASMFS_IO_THREADS=1'],),
     # using proxy_to_pthread also works, of course
     'proxy_to_pthread': (['-sPROXY_TO_PTHREAD', '-DPROXYING'],),
     # using BigInt support affects the ABI, and should not break things. (this
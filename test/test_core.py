@@ -2108,6 +2108,31 @@ int main(int argc, char **argv) {
     self.emcc_args += ['-sINITIAL_MEMORY=16MB', '-sALLOW_MEMORY_GROWTH', '-sMEMORY_GROWTH_GEOMETRIC_STEP=8.5', '-sMEMORY_GROWTH_GEOMETRIC_CAP=32MB']
     self.do_core_test('test_memorygrowth_geometric_step.c')
 
+  @no_asan('ASan uses its own allocator')
+  @no_4gb('depends on INITIAL_MEMORY')
+  @no_2gb('depends on INITIAL_MEMORY')
+  def test_memorygrowth_policy(self):
+    if self.has_changed_setting('ALLOW_MEMORY_GROWTH'):
+      self.skipTest('test needs to modify memory growth')
+
+    self.set_setting('ALLOW_MEMORY_GROWTH')
+    self.do_core_test('test_memorygrowth_policy.c')
+
+  @node_pthreads
+  @no_asan('ASan uses its own allocator')
+  @no_4gb('depends on INITIAL_MEMORY')
+  @no_2gb('depends on INITIAL_MEMORY')
+  def test_memorygrowth_policy_background(self):
+    if self.has_changed_setting('ALLOW_MEMORY_GROWTH'):
+      self.skipTest('test needs to modify memory growth')
+
+    # The growth thread needs a worker to be ready since the main thread
+    # waits for it.
+    self.set_setting('ALLOW_MEMORY_GROWTH')
+    self.set_setting('PTHREAD_POOL_SIZE', 1)
+    self.emcc_args.append('-DBACKGROUND')
+    self.do_runf(test_file('core/test_memorygrowth_policy.c'), 'early grows: 1\nview refreshes: 1\ndone\n')
+
   def test_memorygrowth_3_force_fail_reallocBuffer(self):
     if self.has_changed_setting('ALLOW_MEMORY_GROWTH'):
       self.skipTest('test needs to modify memory growth')
@@ -2964,6 +2989,34 @@ The current type of b is: 9
       '''
     self.do_run(src, 'Constructing main object.\nConstructing lib object.\n')
 
+  @needs_dylink
+  def test_dlfcn_unused_exports(self):
+    # Loading a side module should not give every one of its exports a GOT
+    # entry (and, for functions, a table slot), only the ones that are used.
+    funcs = '\n'.join(f'int func{i}(void) {{ return {i}; }}' for i in range(200))
+    create_file('liblib.c', funcs + '\nint side_value(void) { return 42; }\n')
+    self.build_dlfcn_lib('liblib.c')
+
+    self.prep_dlfcn_main()
+    create_file('main.c', r'''
+      #include <assert.h>
+      #include <dlfcn.h>
+      #include <stdio.h>
+      #include <emscripten/em_asm.h>
+
+      int main() {
+        int before = EM_ASM_INT(return wasmTable.length);
+        void* lib = dlopen("liblib.so", RTLD_NOW);
+        assert(lib);
+        int (*side_value)(void) = dlsym(lib, "side_value");
+        printf("side_value: %d\n", side_value());
+        int after = EM_ASM_INT(return wasmTable.length);
+        printf("table growth: %s\n", after - before < 100 ? "small" : "large");
+        return 0;
+      }
+    ''')
+    self.do_runf('main.c', 'side_value: 42\ntable growth: small\n')
+
   @needs_dylink
   def test_dlfcn_i64(self):
     create_file('liblib.c', '''
@@ -5722,10 +5775,49 @@ got: 10
     self.emcc_args += ['--pre-js', test_file('minimal_runtime_exit_handling.js')]
     self.do_runf('utf8_invalid.cpp', 'OK.', emcc_args=args)
 
+  # With -msimd128, stringToUTF8 uses TextEncoder for long strings, which must
+  # not change how lone surrogates are written.
+  @wasm_simd
+  @parameterized({
+    '': [[]],
+    'textdecoder': [['-sTEXTDECODER=2']],
+  })
+  def test_utf8_lone_surrogates(self, args):
+    self.set_setting('DEFAULT_LIBRARY_FUNCS_TO_INCLUDE', ['$stringToUTF8'])
+    self.do_core_test('test_utf8_lone_surrogates.c', emcc_args=args)
+
   def test_utf16_textdecoder(self):
     self.emcc_args += ['--embed-file', test_file('utf16_corpus.txt') + '@/utf16_corpus.txt']
     self.do_runf('benchmark/benchmark_utf16.cpp', 'OK.')
 
+  # With -msimd128 the JS string functions scan and transcode long strings in
+  # wasm.  Check the results match, including for invalid UTF-8, both with and
+  # without TextDecoder.
+  @wasm_simd
+  @parameterized({
+    '': ([],),
+    'no_textdecoder': (['-sTEXTDECODER=0'],),
+  })
+  def test_utf8_simd(self, args):
+    self.emcc_args += ['-msimd128'] + args
+    self.do_runf('utf8.cpp', 'OK.')
+    self.do_runf('utf8_invalid.cpp', 'OK.')
+    self.emcc_args += ['--embed-file', test_file('utf8_corpus.txt') + '@/utf8_corpus.txt']
+    self.do_runf('benchmark/benchmark_utf8.c', 'OK.')
+
+  # Without TextDecoder, strings over 64 bytes are decoded in wasm and shorter
+  # ones in JS, which must give the same result for invalid UTF-8.
+  @wasm_simd
+  def test_utf8_simd_decoder(self):
+    self.emcc_args += ['-msimd128', '-sTEXTDECODER=0']
+    self.set_setting('DEFAULT_LIBRARY_FUNCS_TO_INCLUDE', ['$UTF8ArrayToString', '$UTF8ToString', '$stringToUTF8'])
+    self.do_core_test('test_utf8_simd_decoder.c')
+
+  @wasm_simd
+  def test_utf16_simd(self):
+    self.emcc_args += ['-msimd128', '--embed-file', test_file('utf16_corpus.txt') + '@/utf16_corpus.txt']
+    self.do_runf('benchmark/benchmark_utf16.cpp', 'OK.')
+
   def test_wprintf(self):
     self.do_core_test('test_wprintf.cpp')
 
@@ -5850,14 +5942,23 @@ got: 10
   def test_fs_append(self):
     self.do_runf('fs/test_append.c', 'success')
 
+  @no_wasmfs('MEMFS_PAGE_SIZE only applies to the JS filesystem')
+  def test_fs_memfs_paged(self):
+    self.set_setting('MEMFS_PAGE_SIZE', 64)
+    self.do_runf('fs/test_memfs_paged.c', 'success')
+
   @parameterized({
     'memfs': ['MEMFS'],
+    'memfs_paged': ['MEMFS_PAGED'],
     'nodefs': ['NODEFS'],
     'noderaswfs': ['NODERAWFS'],
     'wasmfs': ['WASMFS']
   })
   def test_fs_mmap(self, fs):
     self.uses_es6 = True
+    if fs == 'MEMFS_PAGED':
+      self.set_setting('MEMFS_PAGE_SIZE', 64)
+      fs = 'MEMFS'
     if fs == 'NODEFS':
       self.require_node()
       self.emcc_args += ['-lnodefs.js']
@@ -6544,6 +6645,12 @@ void* operator new(size_t size) {
     self.emcc_args.append('-funsigned-char')
     run()
 
+  @wasm_simd
+  def test_string_simd(self):
+    # With -msimd128 the string routines come from libsimdstring
+    self.emcc_args.append('-msimd128')
+    self.do_core_test('test_string_simd.c')
+
   # Tests invoking the NEON SIMD API via arm_neon.h header
   @wasm_simd
   def test_neon_wasm_simd(self):
@@ -6661,6 +6768,20 @@ void* operator new(size_t size) {
     self.maybe_closure()
     self.do_runf(src, native_result)
 
+  # Tests invoking the SIMD API via x86 AVX2 avx2intrin.h header (_mm256_x() functions)
+  @wasm_simd
+  @requires_native_clang
+  @is_slow_test
+  @no_asan('local count too large')
+  def test_avx2(self):
+    src = test_file('sse/test_avx2.cpp')
+    self.run_process([shared.CLANG_CXX, src, '-mavx2', '-Wno-argument-outside-range', '-o', 'test_avx2', '-D_CRT_SECURE_NO_WARNINGS=1'] + clang_native.get_clang_native_args(), stdout=PIPE)
+    native_result = self.run_process('./test_avx2', stdout=PIPE).stdout
+
+    self.emcc_args += ['-I' + test_file('sse'), '-mavx2', '-Wno-argument-outside-range', '-sSTACK_SIZE=1MB']
+    self.maybe_closure()
+    self.do_runf(src, native_result)
+
   @wasm_simd
   def test_sse_diagnostics(self):
     self.emcc_args.remove('-Werror')
@@ -7711,7 +7832,7 @@ void* operator new(size_t size) {
     # Export things on "TheModule". This matches the typical use pattern of
     # the bound library being used as Box2D.* or Ammo.*, and we cannot rely
     # on "Module" being always present (closure may remove it).
-    self.emcc_args += ['-sEXPORTED_FUNCTIONS=_malloc,_free', '-sEXPORTED_RUNTIME_METHODS=stringToUTF8', '--post-js=glue.js', '--extern-post-js=extern-post.js']
+    self.emcc_args += ['-sEXPORTED_FUNCTIONS=_malloc,_free', '-sEXPORTED_RUNTIME_METHODS=stringToUTF8,HEAP8', '--post-js=glue.js', '--extern-post-js=extern-post.js']
     if mode == 'ALL':
       self.emcc_args += ['-sASSERTIONS']
     if allow_memory_growth:
@@ -9177,6 +9298,17 @@ NODEFS is no longer included by default; build with -lnodefs.js
     self.set_setting('PTHREAD_POOL_SIZE', pthread_pool_size)
     self.do_run_in_out_file_test('pthread/test_pthread_cxx_threads.cpp')
 
+  @node_pthreads
+  @parameterized({
+    '': (0,),
+    'pooled': (4,),
+  })
+  def test_pthread_pstl(self, pthread_pool_size):
+    self.set_setting('PTHREAD_POOL_SIZE', pthread_pool_size)
+    self.set_setting('EXIT_RUNTIME')
+    self.emcc_args += ['-std=c++17', '-fexperimental-library']
+    self.do_run_in_out_file_test('pthread/test_pthread_pstl.cpp')
+
   @node_pthreads
   @parameterized({
     '': (0,),
@@ -9350,6 +9482,59 @@ NODEFS is no longer included by default; build with -lnodefs.js
                  ['side module ctor', 'done join', 'side module atexit'],
                  assert_all=True)
 
+  @needs_dylink
+  @node_pthreads
+  def test_pthread_dlopen_shared_module(self):
+    # A side module that is dlopen'd on a worker is compiled there once and
+    # handed to the main thread, which should not need to compile it again
+    # when it catches up.
+    self.emcc_args += ['-Wno-experimental', '-pthread']
+    self.build_dlfcn_lib(test_file('core/pthread/test_pthread_dlopen_side.c'))
+
+    create_file('pre.js', '''
+      var sideModuleCompiles = 0;
+      var sideModuleSyncCompiles = 0;
+      // Side modules start with the dylink.0 custom section.
+      var isSideModule = (bytes) => {
+        bytes = ArrayBuffer.isView(bytes) ? new Uint8Array(bytes.buffer, bytes.byteOffset, bytes.byteLength) : new Uint8Array(bytes);
+        return String.fromCharCode(...bytes.subarray(0, 32)).includes('dylink.0');
+      };
+      var realCompile = WebAssembly.compile;
+      var realInstantiate = WebAssembly.instantiate;
+      WebAssembly.compile = (...args) => {
+        if (runtimeInitialized) sideModuleCompiles++;
+        return realCompile(...args);
+      };
+      WebAssembly.instantiate = (source, ...args) => {
+        if (runtimeInitialized && !(source instanceof WebAssembly.Module)) sideModuleCompiles++;
+        return realInstantiate(source, ...args);
+      };
+      // The main thread catches up with dlopen calls on other threads using the
+      // synchronous constructor.  A Proxy keeps `instanceof WebAssembly.Module`
+      // working.
+      WebAssembly.Module = new Proxy(WebAssembly.Module, {
+        construct(target, args) {
+          if (isSideModule(args[0])) sideModuleSyncCompiles++;
+          return new target(...args);
+        }
+      });
+      Module.onExit = () => {
+        if (!ENVIRONMENT_IS_PTHREAD) {
+          out(`side module compiles on main thread: ${sideModuleCompiles}`);
+          out(`side module sync compiles on main thread: ${sideModuleSyncCompiles}`);
+        }
+      };
+    ''')
+    self.emcc_args += ['--embed-file', 'liblib.so@libside.so', '--pre-js', 'pre.js']
+    self.prep_dlfcn_main()
+    self.set_setting('EXIT_RUNTIME')
+    self.set_setting('PROXY_TO_PTHREAD')
+    self.do_runf('core/pthread/test_pthread_dlopen.c',
+                 ['side module ctor', 'done join',
+                  'side module compiles on main thread: 0',
+                  'side module sync compiles on main thread: 0'],
+                 assert_all=True)
+
   @needs_dylink
   @node_pthreads
   def test_pthread_dlopen_many(self):
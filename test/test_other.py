@@ -1960,6 +1960,71 @@ Module['postRun'] = () => {
     result = self.run_js('a.out.js')
     self.assertContained('|hello from a file wi|', result)
 
+  @parameterized({
+    '': ([],),
+    'O2': (['-O2'],),
+    'growth': (['-sALLOW_MEMORY_GROWTH', '-DGROW'],),
+  })
+  @requires_node
+  def test_memory_snapshot(self, args):
+    create_file('somefile.txt', 'hello from a preloaded file')
+    create_file('main.c', r'''
+      #include <stdio.h>
+      #include <stdlib.h>
+      #include <string.h>
+
+      static char* greeting;
+
+      __attribute__((constructor)) static void init(void) {
+        printf("running ctor\n");
+        greeting = strdup("hello from a constructor");
+      #ifdef GROW
+        // The snapshot needs more than the initial memory.
+        memset(malloc(20 * 1024 * 1024), 1, 20 * 1024 * 1024);
+      #endif
+        FILE* f = fopen("/created.txt", "w");
+        fputs("hello from a created file", f);
+        fclose(f);
+      }
+
+      static void print_file(const char* name) {
+        char buf[100] = {0};
+        FILE* f = fopen(name, "r");
+        fread(buf, 1, sizeof(buf) - 1, f);
+        fclose(f);
+        printf("%s\n", buf);
+      }
+
+      int main() {
+        printf("%s\n", greeting);
+        print_file("somefile.txt");
+        print_file("/created.txt");
+        printf("SNAPSHOT_ENV=%s\n", getenv("SNAPSHOT_ENV"));
+        return 0;
+      }
+    ''')
+    # The environment seen by main() is the one at runtime, not the one while
+    # taking the snapshot.
+    create_file('pre.js', '''
+      Module.preRun ||= [];
+      Module.preRun.push(() => { ENV.SNAPSHOT_ENV = Module['takeSnapshot'] ? 'snapshot' : 'runtime'; });
+    ''')
+    self.run_process([EMCC, 'main.c', '-sMEMORY_SNAPSHOT', '-Wno-experimental',
+                      '--preload-file', 'somefile.txt', '--pre-js', 'pre.js'] + args)
+    self.assertExists('a.out.snapshot')
+    # The preloaded files are in the snapshot, so the data file is not needed.
+    delete_file('a.out.data')
+    output = self.run_js('a.out.js')
+    self.assertContained('hello from a constructor\nhello from a preloaded file\nhello from a created file\nSNAPSHOT_ENV=runtime\n', output)
+    # The constructor ran while taking the snapshot, and not again.
+    self.assertNotContained('running ctor', output)
+
+  def test_memory_snapshot_errors(self):
+    err = self.expect_fail([EMCC, test_file('hello_world.c'), '-sMEMORY_SNAPSHOT', '-pthread'])
+    self.assertContained('MEMORY_SNAPSHOT is not compatible with pthreads or wasm workers', err)
+    err = self.expect_fail([EMCC, test_file('hello_world.c'), '-sMEMORY_SNAPSHOT', '-sENVIRONMENT=web'])
+    self.assertContained('MEMORY_SNAPSHOT requires node in ENVIRONMENT', err)
+
   @parameterized({
     '': ([],),
     'wasmfs': (['-sWASMFS'],),
@@ -9834,6 +9899,31 @@ int main() {
     self.assertContained('GROWABLE_HEAP_I8().set([ 1, 2, 3 ], $0 >>> 0)',
                          read_file('a.out.js'))
 
+  def test_pthreads_growth_growable_arraybuffers(self):
+    # With views on a resizable buffer, heap accesses are left alone.
+    self.run_process([EMCC, test_file('hello_world.c'), '-O2', '--profiling', '-pthread',
+                      '-sALLOW_MEMORY_GROWTH', '-sGROWABLE_ARRAYBUFFERS'])
+    js = read_file('a.out.js')
+    self.assertNotContained('GROWABLE_HEAP_', js)
+    self.assertContained('toResizableBuffer()', js)
+
+  def test_growable_arraybuffers_errors(self):
+    err = self.expect_fail([EMCC, test_file('hello_world.c'), '-sGROWABLE_ARRAYBUFFERS'])
+    self.assertContained('GROWABLE_ARRAYBUFFERS requires -pthread and -sALLOW_MEMORY_GROWTH', err)
+    err = self.expect_fail([EMCC, test_file('hello_world.c'), '-pthread', '-sGROWABLE_ARRAYBUFFERS'])
+    self.assertContained('GROWABLE_ARRAYBUFFERS requires -pthread and -sALLOW_MEMORY_GROWTH', err)
+    # WebGL rejects views on the resizable buffer.
+    err = self.expect_fail([EMCC, test_file('browser/webgl_draw_triangle.c'), '-lGL', '-pthread', '-sALLOW_MEMORY_GROWTH',
+                            '-sGROWABLE_ARRAYBUFFERS'])
+    self.assertContained('WebGL is not supported with GROWABLE_ARRAYBUFFERS', err)
+
+  @requires_node_canary
+  def test_pthreads_growth_growable_arraybuffers_run(self):
+    self.do_runf(test_file('pthread/test_pthread_memory_growth.c'), 'join\n',
+                 emcc_args=['-pthread', '-sPTHREAD_POOL_SIZE=1', '-sALLOW_MEMORY_GROWTH',
+                            '-sGROWABLE_ARRAYBUFFERS', '-sINITIAL_MEMORY=32MB',
+                            '-sMAXIMUM_MEMORY=256MB', '-sEXIT_RUNTIME'])
+
   @parameterized({
     '': ([],), # noqa
     'O3': (['-O3'],), # noqa
@@ -10081,6 +10171,49 @@ int main() {
     # The name section will not show bar, as it's inlined into main
     check_func_info('test_dwarf.wasm', unreachable_addr, '__original_main')
 
+  def test_sampling_profiler(self):
+    create_file('main.c', r'''
+      #include <emscripten/emscripten.h>
+
+      __attribute__((noinline)) double busy_loop(double end) {
+        double n = 0;
+        while (emscripten_get_now() < end) {
+          n++;
+        }
+        return n;
+      }
+
+      int main() {
+        return busy_loop(emscripten_get_now() + 500) < 0;
+      }
+    ''')
+    self.run_process([EMCC, 'main.c', '-sSAMPLING_PROFILER', '-sSAMPLING_PROFILER_INTERVAL=100', '--profiling-funcs'])
+    self.run_js('a.out.js')
+    # Functions in the name section appear under their names, without the `$`
+    # that V8 adds.
+    folded = read_file('profile.folded')
+    self.assertContained('main;busy_loop', folded)
+    self.assertNotContained('$busy_loop', folded)
+    for line in folded.splitlines():
+      self.assertRegex(line, r'^\S.* \d+$')
+
+    # emsymbolizer leaves named frames alone.
+    out = self.run_process([emsymbolizer, '--folded', 'profile.folded', 'a.out.wasm'], stdout=PIPE).stdout
+    self.assertContained('main;busy_loop', out)
+
+    # Optimized builds without a name section refer to wasm functions by index,
+    # and can be symbolized with a symbol map.
+    self.run_process([EMCC, 'main.c', '-sSAMPLING_PROFILER', '-sSAMPLING_PROFILER_INTERVAL=100', '-O2', '--emit-symbol-map'])
+    self.run_js('a.out.js')
+    self.assertContained('wasm-function[', read_file('profile.folded'))
+    out = self.run_process([emsymbolizer, '--folded', 'profile.folded', '-f', 'a.out.js.symbols', 'a.out.wasm'], stdout=PIPE).stdout
+    self.assertContained('main', out)
+    self.assertNotContained('wasm-function[', out)
+
+  def test_sampling_profiler_web(self):
+    err = self.expect_fail([EMCC, test_file('hello_world.c'), '-sSAMPLING_PROFILER', '-sENVIRONMENT=web'])
+    self.assertContained('SAMPLING_PROFILER is only supported under Node.js', err)
+
   def test_separate_dwarf(self):
     self.run_process([EMCC, test_file('hello_world.c'), '-g'])
     self.assertExists('a.out.wasm')
@@ -10505,6 +10638,25 @@ _d
     self.assertContained('[asyncify] g can', out)
     self.assertContained('[asyncify] i can', out)
 
+  def test_asyncify_profile(self):
+    self.set_setting('ASYNCIFY')
+    self.set_setting('ASYNCIFY_IMPORTS', ['async_func'])
+    self.set_setting('EXIT_RUNTIME')
+    report = self.do_runf('other/test_asyncify_profile.c', 'counter: 13\n', emcc_args=['-sASYNCIFY_PROFILE'])
+    self.assertContained('asyncify profile: 2 unwinds from 2 distinct call stacks', report)
+    self.assertContained('1 unwinds, ', report)
+    funcs = report.split('ASYNCIFY_ONLY response file (e.g. -sASYNCIFY_ONLY=@funcs.txt):\n')[1]
+    funcs, stack_size = funcs.split('asyncify profile: suggested -sASYNCIFY_STACK_SIZE=')
+    funcs = funcs.splitlines()
+    self.assertIn('sleeps', funcs)
+    self.assertIn('calls_sleeps', funcs)
+    self.assertNotIn('never_sleeps', funcs)
+
+    # The suggested settings must be enough to run the program.
+    create_file('funcs.txt', '\n'.join(funcs))
+    self.do_runf('other/test_asyncify_profile.c', 'counter: 13\n',
+                 emcc_args=['-sASYNCIFY_ONLY=@funcs.txt', '-sASYNCIFY_STACK_SIZE=' + stack_size.strip()])
+
   def test_asyncify_stack_overflow(self):
     self.emcc_args = ['-sASYNCIFY', '-sASYNCIFY_STACK_SIZE=4']
 
@@ -12023,6 +12175,11 @@ Aborted(`Module.arguments` has been replaced by `arguments_` (the initial value
     self.set_setting('PTHREAD_POOL_SIZE', 1)
     self.do_run_in_out_file_test('other/test_pthread_reuse.c')
 
+  @node_pthreads
+  def test_pthread_pool_warm(self):
+    self.set_setting('PTHREAD_POOL_WARM', 2)
+    self.do_run_in_out_file_test('other/test_pthread_pool_warm.c')
+
   @node_pthreads
   def test_pthread_relocatable(self):
     self.do_runf('hello_world.c', 'hello, world!', emcc_args=['-sRELOCATABLE'])
@@ -12711,6 +12868,23 @@ exec "$@"
     self.assertRegex(output, r'Thread "Application main thread" \(0x.*\) now: waiting for a futex.')
     self.assertRegex(output, r'Thread "test worker" \(0x.*\) now: sleeping.')
 
+  @node_pthreads
+  def test_threadprofiler_trace(self):
+    create_file('pre.js', "Module['threadProfilerTraceFile'] = 'trace.json';")
+    self.run_process([EMCC, test_file('test_threadprofiler.cpp'), '-pthread', '-sPROXY_TO_PTHREAD', '-sEXIT_RUNTIME', '--threadprofiler', '-sASSERTIONS', '--pre-js=pre.js'])
+    self.run_js('a.out.js')
+    trace = json.loads(read_file('trace.json'))['traceEvents']
+    names = {e['tid']: e['args']['name'] for e in trace if e['ph'] == 'M'}
+    self.assertIn('Browser main thread', names.values())
+    self.assertIn('test worker', names.values())
+    worker = [tid for tid, name in names.items() if name == 'test worker'][0]
+    sleeps = [e for e in trace if e['ph'] == 'X' and e['tid'] == worker and e['name'] == 'sleeping']
+    # The worker sleeps twice for a second each time. Its timeline is kept
+    # after it has exited.
+    self.assertEqual(len(sleeps), 2)
+    for e in sleeps:
+      self.assertGreater(e['dur'], 900 * 1000)
+
   def test_syslog(self):
     self.do_other_test('test_syslog.c')
 
@@ -12755,6 +12929,58 @@ exec "$@"
     if jspi:
       self.assertIn('result is promise', result)
 
+  @parameterized({
+    '': ([],),
+    'g': (['-g'],),
+  })
+  def test_split_module_chunks(self, args):
+    self.emcc_args += ['-sSPLIT_MODULE', '-Wno-experimental', '-sEXPORTED_FUNCTIONS=_malloc,_free']
+    self.emcc_args += ['--post-js', test_file('other/test_split_module.post.js')] + args
+    self.do_other_test('test_split_module.c')
+    self.assertExists('profile.data')
+
+    # The profile is written before say_hello() is called, so it and foo()
+    # are moved out of the primary module, each into a chunk of its own.
+    self.emcc_args += ['-sSPLIT_MODULE_PROFILES=profile.data', '-sSPLIT_MODULE_CHUNK_SIZE=1']
+    self.build(test_file('other/test_split_module.c'))
+    self.assertNotExists('test_split_module.wasm.orig')
+    self.assertExists('test_split_module.chunk0.wasm')
+    self.assertExists('test_split_module.chunk1.wasm')
+    result = self.run_js('test_split_module.js')
+    self.assertNotIn('profile', result)
+    self.assertIn('Hello! answer: 42', result)
+
+  def test_split_module_chunks_prefetch(self):
+    self.emcc_args += ['-sSPLIT_MODULE', '-Wno-experimental', '-sEXPORTED_FUNCTIONS=_malloc,_free']
+    self.emcc_args += ['--pre-js', test_file('other/test_split_module_chunks.pre.js')]
+    self.emcc_args += ['--post-js', test_file('other/test_split_module_chunks.post.js')]
+    self.build(test_file('other/test_split_module.c'))
+    result = self.run_js('test_split_module.js')
+    self.assertContained('wrote startup.data\nHello! answer: 42\nwrote later.data\n', result)
+
+    # say_hello() and foo() are first called after startup, so they go into a
+    # chunk that is compiled in the background, and used when say_hello() is
+    # first called rather than loaded synchronously.
+    self.emcc_args += ['-sSPLIT_MODULE_PROFILES=startup.data,later.data']
+    self.build(test_file('other/test_split_module.c'))
+    result = self.run_js('test_split_module.js')
+    self.assertContained('chunk compiled ahead of its first call\nHello! answer: 42\n', result)
+    self.assertNotContained('synchronously', result)
+
+  def test_split_module_profiles_errors(self):
+    err = self.expect_fail([EMCC, test_file('hello_world.c'), '-sSPLIT_MODULE_PROFILES=profile.data'])
+    self.assertContained('SPLIT_MODULE_PROFILES requires SPLIT_MODULE', err)
+    err = self.expect_fail([EMCC, test_file('hello_world.c'), '-sSPLIT_MODULE', '-Wno-experimental', '-sSPLIT_MODULE_PROFILES=missing.data'])
+    self.assertContained('SPLIT_MODULE_PROFILES: profile not found: missing.data', err)
+
+    # A profile of a differently built module is rejected.
+    self.run_process([EMCC, test_file('other/test_split_module.c'), '-O1', '-sSPLIT_MODULE', '-Wno-experimental',
+                      '-sEXPORTED_FUNCTIONS=_malloc,_free', '--post-js', test_file('other/test_split_module.post.js')])
+    self.run_js('a.out.js')
+    err = self.expect_fail([EMCC, test_file('other/test_split_module.c'), '-sSPLIT_MODULE', '-Wno-experimental',
+                            '-sEXPORTED_FUNCTIONS=_malloc,_free', '-sSPLIT_MODULE_PROFILES=profile.data'])
+    self.assertContained('does not match', err)
+
   def test_split_main_module(self):
     # Set and reasonably large initial table size to avoid test fragility.
     # The actual number of slots needed is closer to 18 but we don't want
@@ -13115,6 +13341,12 @@ kill -9 $$
     # includes the native GL library.
     self.run_process([EMCC, test_file('other/test_explicit_gl_linking.c'), '-sNO_AUTO_NATIVE_LIBRARIES', '-lGL', '-sGL_ENABLE_GET_PROC_ADDRESS'])
 
+  def test_gl_client_array_ring(self):
+    # Client-side vertex arrays are uploaded with one bufferSubData per draw
+    # into a single ring buffer, which is replaced when a draw doesn't fit.
+    # This runs against a mock WebGL context, see the test source.
+    self.do_other_test('test_gl_client_array_ring.c', emcc_args=['-lGL', '-sFULL_ES2', '-sGL_PREINITIALIZED_CONTEXT', '-sGL_CLIENT_ARRAY_RING_BUFFER_SIZE=1024'])
+
   def test_no_main_with_PROXY_TO_PTHREAD(self):
     create_file('lib.c', r'''
 #include <emscripten.h>
@@ -13494,6 +13726,16 @@ Module.postRun = () => {{
     self.set_setting('FORCE_FILESYSTEM')
     self.do_run_in_out_file_test('wasmfs/wasmfs_getdents.c')
 
+  @wasmfs_all_backends
+  def test_wasmfs_readdir_stat(self):
+    self.set_setting('FORCE_FILESYSTEM')
+    self.do_run_in_out_file_test('wasmfs/wasmfs_readdir_stat.c')
+
+  @wasmfs_all_backends
+  def test_wasmfs_readv(self):
+    self.set_setting('FORCE_FILESYSTEM')
+    self.do_run_in_out_file_test('wasmfs/wasmfs_readv.c')
+
   @wasmfs_all_backends
   def test_wasmfs_readfile(self):
     self.set_setting('FORCE_FILESYSTEM')
@@ -13510,6 +13752,14 @@ Module.postRun = () => {{
     self.set_setting('WASMFS')
     self.do_run_in_out_file_test('wasmfs/wasmfs_jsfile.c')
 
+  @parameterized({
+    '': ([],),
+    'pthreads': (['-pthread', '-sPTHREAD_POOL_SIZE=1'],),
+  })
+  def test_wasmfs_async(self, args):
+    self.set_setting('WASMFS')
+    self.do_run_in_out_file_test('wasmfs/wasmfs_async.c', emcc_args=args)
+
   def test_wasmfs_before_preload(self):
     self.set_setting('WASMFS')
     os.mkdir('js_backend_files')
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <assert.h>
+#include <emscripten/wasmfs.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// Chains asynchronous operations through their callbacks, checking that each
+// one runs on the main thread after main() has returned.
+
+static const char msg[] = "Hello, async!";
+static char buf[sizeof(msg)];
+static struct stat st;
+static int fd;
+static int returned;
+
+static void on_reopen_missing(void* arg, ssize_t result);
+
+static void on_close(void* arg, ssize_t result) {
+  printf("close: %zd\n", result);
+  assert(result == 0);
+  wasmfs_async_open(
+    "/nonexistent", O_RDONLY, 0, on_reopen_missing, NULL);
+}
+
+static void on_reopen_missing(void* arg, ssize_t result) {
+  printf("open missing: %s\n", result == -ENOENT ? "ENOENT" : "unexpected");
+  assert(result == -ENOENT);
+  puts("done");
+  exit(0);
+}
+
+static void on_stat(void* arg, ssize_t result) {
+  printf("stat: %zd, size: %lld\n", result, (long long)st.st_size);
+  assert(result == 0);
+  assert(st.st_size == sizeof(msg));
+  wasmfs_async_close(fd, on_close, NULL);
+}
+
+static void on_read(void* arg, ssize_t result) {
+  printf("read: %zd, %s\n", result, buf);
+  assert(result == sizeof(msg));
+  assert(strcmp(buf, msg) == 0);
+  wasmfs_async_stat("/file", &st, on_stat, NULL);
+}
+
+static void on_write(void* arg, ssize_t result) {
+  printf("write: %zd\n", result);
+  assert(result == sizeof(msg));
+  wasmfs_async_read(fd, buf, sizeof(buf), 0, on_read, NULL);
+}
+
+static void on_open(void* arg, ssize_t result) {
+  assert(returned);
+  assert(arg == &fd);
+  printf("open: %s\n", result >= 0 ? "ok" : "failed");
+  assert(result >= 0);
+  fd = result;
+  wasmfs_async_write(fd, msg, sizeof(msg), 0, on_write, NULL);
+}
+
+int main() {
+  wasmfs_async_open("/file", O_CREAT | O_RDWR, 0666, on_open, &fd);
+  returned = 1;
+  return 0;
+}
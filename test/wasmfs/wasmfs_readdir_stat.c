@@ -0,0 +1,119 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <assert.h>
+#include <dirent.h>
+#include <emscripten/wasmfs.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "get_backend.h"
+
+#ifdef WASMFS_NODE_BACKEND
+#define MIRROR "/mirror"
+#define MIRROR2 "/mirror2"
+#else
+#define MIRROR "/root"
+#define MIRROR2 "/root"
+#endif
+
+// Listing a directory and then stat-ing each child, like `ls -l`, must give the
+// same results whether or not the backend reported the children's attributes
+// along with the listing.
+
+void write_file(const char* path, size_t size, off_t offset) {
+  char buf[256];
+  memset(buf, 'a', sizeof(buf));
+  assert(size <= sizeof(buf));
+  int fd = open(path, O_WRONLY | O_CREAT, 0777);
+  assert(fd != -1);
+  int nwritten = pwrite(fd, buf, size, offset);
+  assert(nwritten == size);
+  int err = close(fd);
+  assert(err == 0);
+}
+
+int not_dot(const struct dirent* entry) {
+  return strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0;
+}
+
+// Children that have not been looked up before the listing have no inode
+// number yet, so only check the ones from the listing when `all_known` is set.
+void list(const char* dir, int all_known) {
+  printf("listing:\n");
+  struct dirent** entries;
+  int nentries = scandir(dir, &entries, not_dot, alphasort);
+  assert(nentries != -1);
+  for (int i = 0; i < nentries; i++) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s", dir, entries[i]->d_name);
+    struct stat st;
+    int err = lstat(path, &st);
+    assert(err == 0);
+    // The inode reported by the listing must match the one from stat.
+    assert(entries[i]->d_ino == st.st_ino || (!all_known && !entries[i]->d_ino));
+    if (S_ISDIR(st.st_mode)) {
+      assert(entries[i]->d_type == DT_DIR);
+      printf("  %s/\n", entries[i]->d_name);
+    } else {
+      assert(entries[i]->d_type == DT_REG);
+      printf("  %s %lld\n", entries[i]->d_name, (long long)st.st_size);
+    }
+    free(entries[i]);
+  }
+  free(entries);
+}
+
+void print_size(const char* path) {
+  struct stat st;
+  int err = stat(path, &st);
+  assert(err == 0);
+  printf("size: %lld\n", (long long)st.st_size);
+}
+
+int main() {
+  int err = wasmfs_create_directory("/root", 0777, get_backend());
+  assert(err == 0);
+  err = mkdir("/root/dir", 0777);
+  assert(err == 0);
+  err = mkdir("/root/dir/sub", 0777);
+  assert(err == 0);
+  write_file("/root/dir/a", 10, 0);
+  write_file("/root/dir/b", 200, 0);
+  write_file("/root/dir/c", 0, 0);
+
+  list("/root/dir", 1);
+
+  // A second mount of the same Node directory starts out with nothing in its
+  // directory cache, so all of its children come from the listing. Other
+  // backends do not share storage between mounts and just use /root again.
+  err = wasmfs_create_directory("/mirror", 0777, get_backend());
+  assert(err == 0);
+  list(MIRROR "/dir", 0);
+  // Listing again reuses the children that were looked up.
+  list(MIRROR "/dir", 1);
+
+  // List another fresh mount without stat-ing the children, then grow a file
+  // through a different mount. The size reported by the listing is out of date
+  // now, so stat must not use it.
+  err = wasmfs_create_directory("/mirror2", 0777, get_backend());
+  assert(err == 0);
+  DIR* dir = opendir(MIRROR2 "/dir");
+  assert(dir);
+  while (readdir(dir)) {
+  }
+  closedir(dir);
+  write_file("/root/dir/a", 20, 10);
+  print_size(MIRROR2 "/dir/a");
+
+  printf("done\n");
+  return 0;
+}
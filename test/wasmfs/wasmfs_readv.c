@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024 The Emscripten Authors.  All rights reserved.
+ * Emscripten is available under two separate licenses, the MIT license and the
+ * University of Illinois/NCSA Open Source License.  Both these licenses can be
+ * found in the LICENSE file.
+ */
+
+#include <assert.h>
+#include <emscripten/wasmfs.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "get_backend.h"
+
+// Scatter and gather I/O must behave the same whether the backend accesses
+// each buffer in turn or all of them at once.
+
+void print_iovs(struct iovec* iovs, int iovcnt, ssize_t n) {
+  printf("%zd:", n);
+  for (int i = 0; i < iovcnt && n > 0; i++) {
+    size_t len = n < iovs[i].iov_len ? n : iovs[i].iov_len;
+    printf(" \"%.*s\"", (int)len, (char*)iovs[i].iov_base);
+    n -= len;
+  }
+  printf("\n");
+}
+
+int main() {
+  int err = wasmfs_create_directory("/root", 0777, get_backend());
+  assert(err == 0);
+
+  int fd = open("/root/file", O_RDWR | O_CREAT | O_TRUNC, 0777);
+  assert(fd != -1);
+
+  // Gather from several buffers, including an empty one.
+  char a[] = "hello", b[] = ", ", c[] = "world";
+  struct iovec out[] = {
+    {a, 5},
+    {b, 0},
+    {b, 2},
+    {c, 5},
+  };
+  ssize_t n = writev(fd, out, 4);
+  assert(n == 12);
+  off_t pos = lseek(fd, 0, SEEK_CUR);
+  assert(pos == 12);
+
+  // Gather at an offset without moving the file position.
+  struct iovec patch[] = {{"W", 1}, {"!", 1}};
+  n = pwritev(fd, patch, 2, 7);
+  assert(n == 2);
+  pos = lseek(fd, 0, SEEK_CUR);
+  assert(pos == 12);
+
+  // Scatter into several buffers.
+  char x[4], y[3], z[8];
+  struct iovec in[] = {
+    {x, sizeof(x)},
+    {y, 0},
+    {y, sizeof(y)},
+    {z, sizeof(z)},
+  };
+  n = preadv(fd, in, 4, 0);
+  print_iovs(in, 4, n);
+
+  // Scatter with the end of the file in the middle of the buffers.
+  n = preadv(fd, in, 4, 6);
+  print_iovs(in, 4, n);
+
+  // Scatter from the end of the file.
+  n = preadv(fd, in, 4, 12);
+  print_iovs(in, 4, n);
+
+  // Scatter using the file position.
+  pos = lseek(fd, 2, SEEK_SET);
+  assert(pos == 2);
+  n = readv(fd, in, 4);
+  print_iovs(in, 4, n);
+  pos = lseek(fd, 0, SEEK_CUR);
+  assert(pos == 12);
+
+  err = close(fd);
+  assert(err == 0);
+
+  printf("done\n");
+  return 0;
+}
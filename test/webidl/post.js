@@ -227,6 +227,25 @@ console.log('struct_ptr_array[0]->attr2 == ' + arrayClass.get_struct_ptr_array(0
 var receiver = new TheModule.ReceiveArrays();
 receiver.giveMeArrays([0.5, 0.25, 0.01, -20.42], [1, 4, 9, 10], 4);
 
+// Typed arrays that are already views of the heap are passed by address, and
+// large arrays go through the scratch buffer rather than the stack.
+var verticesPtr = TheModule._malloc(8);
+var trianglesPtr = TheModule._malloc(8);
+var heapVertices = new Float32Array(TheModule['HEAP8'].buffer, verticesPtr, 2);
+var heapTriangles = new Int32Array(TheModule['HEAP8'].buffer, trianglesPtr, 2);
+heapVertices.set([1.5, 2.5]);
+heapTriangles.set([3, 5]);
+receiver.giveMeArrays(heapVertices, heapTriangles, 2);
+TheModule._free(verticesPtr);
+TheModule._free(trianglesPtr);
+receiver.giveMeArrays(new Float32Array(300).fill(0.75), new Array(300).fill(7), 2);
+// A heap view of another element type is converted, not reinterpreted.
+var intsPtr = TheModule._malloc(8);
+var heapInts = new Int32Array(TheModule['HEAP8'].buffer, intsPtr, 2);
+heapInts.set([4, 6]);
+receiver.giveMeArrays(heapInts, [9, 9], 2);
+TheModule._free(intsPtr);
+
 // Test IDL_CHECKS=ALL
 
 try {
@@ -294,11 +313,11 @@ if (isMemoryGrowthAllowed) {
   var startHeapLength = TheModule['HEAP8'].length;
   var offset;
   var storeArray = new TheModule.StoreArray();
-  storeArray.setArray(intArray);
+  storeArray.setArray(intArray, intArray.length);
   // Add more data until the heap is reallocated
   while (TheModule['HEAP8'].length === startHeapLength) {
     intArray = intArray.concat(intArray);
-    storeArray.setArray(intArray);
+    storeArray.setArray(intArray, intArray.length);
   }
 
   // Make sure the array was copied to the newly allocated HEAP
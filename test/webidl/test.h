@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 // Part 1
 
@@ -181,13 +182,17 @@ struct ReceiveArrays {
 
 struct StoreArray {
   StoreArray() : int_array(NULL) {}
-  void setArray(const int *array) {
-    int_array = array;
+  ~StoreArray() { free(int_array); }
+  // Array arguments are only valid during the call, so keep a copy.
+  void setArray(const int *array, int size) {
+    free(int_array);
+    int_array = (int*)malloc(size * sizeof(int));
+    memcpy(int_array, array, size * sizeof(int));
   }
   int getArrayValue(int index) const {
     return int_array[index];
   }
-  const int* int_array;
+  int* int_array;
 };
 
 typedef struct LongLongTypes {
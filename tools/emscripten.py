@@ -1085,6 +1085,10 @@ def create_pointer_conversion_wrappers(metadata):
     '_emscripten_set_offscreencanvas_size_on_thread': '_pp__',
     'fileno': '_p',
     '_emscripten_run_callback_on_thread': '_pp_pp',
+    '_emscripten_html5_event_ring_push': '_pp_ppp',
+    '_emscripten_utf8_length': 'ppp',
+    '_emscripten_utf8_to_utf16': 'pppp',
+    '_emscripten_utf16_length': 'ppp',
   }
 
   for function in settings.SIGNATURE_CONVERSIONS:
@@ -35,6 +35,7 @@ class Feature(IntEnum):
   THREADS = auto()
   GLOBALTHIS = auto()
   PROMISE_ANY = auto()
+  GROWABLE_ARRAYBUFFERS = auto()
 
 
 default_features = {Feature.SIGN_EXT, Feature.MUTABLE_GLOBALS}
@@ -82,6 +83,12 @@ min_browser_versions = {
     'safari': 140000,
     'node': 150000,
   },
+  Feature.GROWABLE_ARRAYBUFFERS: {
+    'chrome': 136,
+    'firefox': UNSUPPORTED,
+    'safari': UNSUPPORTED,
+    'node': 240000,
+  },
 }
 
 
@@ -136,3 +143,5 @@ def apply_min_browser_versions():
     enable_feature(Feature.BULK_MEMORY, 'pthreads')
   if settings.AUDIO_WORKLET:
     enable_feature(Feature.GLOBALTHIS, 'AUDIO_WORKLET')
+  if settings.GROWABLE_ARRAYBUFFERS:
+    enable_feature(Feature.GROWABLE_ARRAYBUFFERS, 'GROWABLE_ARRAYBUFFERS')
@@ -15,6 +15,7 @@ import re
 import shlex
 import stat
 import shutil
+import struct
 import time
 from subprocess import PIPE
 from urllib.parse import quote
@@ -472,6 +473,93 @@ def do_split_module(wasm_file, options):
   building.run_binaryen_command('wasm-split', wasm_file + '.orig', outfile=wasm_file, args=args)
 
 
+def read_split_profile(filename, wasm_file, num_funcs):
+  # A profile written by the instrumented module that wasm-split creates: an
+  # 8 byte hash of the module followed by a 4 byte timestamp for each defined
+  # function, which is 0 for functions that were not called.  Have wasm-split
+  # check the hash, since it alone knows how it is computed.
+  building.run_binaryen_command('wasm-split', wasm_file, args=['--print-profile=' + filename], stdout=PIPE)
+  data = read_binary(filename)
+  if len(data) != 8 + 4 * num_funcs:
+    exit_with_error(f'{filename} does not match this program.  Profiles must be written by a -sSPLIT_MODULE build with the same inputs and flags.')
+  return struct.unpack(f'<{num_funcs}I', data[8:])
+
+
+def get_binaryen_function_names(wasm_file):
+  # The names that wasm-split will use for the functions, in index order.
+  # Binaryen makes duplicate names in the name section unique, and names
+  # functions without one after their index.
+  output = building.run_wasm_opt(wasm_file, args=['--print-function-map'], stdout=PIPE)
+  names = []
+  for line in output.splitlines():
+    index, name = line.split(':', 1)
+    assert int(index) == len(names)
+    names.append(name)
+  return names
+
+
+def group_into_chunks(funcs, sizes):
+  chunks = []
+  size = 0
+  for func in funcs:
+    if not chunks or size + sizes[func] > settings.SPLIT_MODULE_CHUNK_SIZE:
+      chunks.append([])
+      size = 0
+    chunks[-1].append(func)
+    size += sizes[func]
+  return chunks
+
+
+def split_module_chunks(wasm_file, js_file, options):
+  """Splits the wasm into a primary module and many secondary modules based on
+  SPLIT_MODULE_PROFILES, and tells the JS which table slots each secondary
+  module fills in."""
+  with webassembly.Module(wasm_file) as module:
+    num_imported_funcs = module.num_imported_funcs()
+    sizes = [f.size for f in module.get_functions()]
+  func_names = get_binaryen_function_names(wasm_file)[num_imported_funcs:]
+
+  profiles = [read_split_profile(p, wasm_file, len(sizes)) for p in settings.SPLIT_MODULE_PROFILES]
+  startup = {i for i, timestamp in enumerate(profiles[0]) if timestamp}
+  # dict keeps the order in which the functions were first called.
+  used_later = {}
+  for timestamps in profiles[1:]:
+    for _, i in sorted((timestamp, i) for i, timestamp in enumerate(timestamps) if timestamp):
+      if i not in startup:
+        used_later.setdefault(i)
+  unused = [i for i in range(len(sizes)) if i not in startup and i not in used_later]
+  prefetched = group_into_chunks(used_later, sizes)
+  chunks = prefetched + group_into_chunks(unused, sizes)
+  logger.debug(f'splitting wasm into {len(chunks)} chunks ({len(prefetched)} prefetched)')
+
+  slots = []
+  if chunks:
+    manifest = in_temp('split_manifest.txt')
+    write_file(manifest, '\n'.join(f'{n}\n' + ''.join(func_names[i] + '\n' for i in chunk) for n, chunk in enumerate(chunks)))
+    prefix = unsuffixed(wasm_file) + '.chunk'
+    unsplit = in_temp('unsplit.wasm')
+    shutil.copyfile(wasm_file, unsplit)
+    args = ['--multi-split', '--manifest=' + manifest, '--out-prefix=' + prefix, '--export-prefix=%']
+    if options.requested_debug:
+      # Tell wasm-split to preserve function names.
+      args += ['-g']
+    building.run_binaryen_command('wasm-split', unsplit, outfile=wasm_file, args=args)
+    for n in range(len(chunks)):
+      ranges = []
+      with webassembly.Module(f'{prefix}{n}.wasm') as module:
+        for segment in module.get_elem_segments():
+          if segment.flags & webassembly.SEG_PASSIVE:
+            continue
+          opcode, immediates = segment.init[0]
+          assert opcode == webassembly.OpCode.I32_CONST
+          ranges += [immediates[0], immediates[0] + segment.count]
+      slots.append(ranges)
+
+  js = read_file(js_file)
+  js = do_replace(js, '<<< SPLIT_MODULE_CHUNKS >>>', json.dumps([len(prefetched)] + slots, separators=(',', ':')))
+  write_file(js_file, js)
+
+
 def get_worker_js_suffix():
   return '.worker.mjs' if settings.EXPORT_ES6 else '.worker.js'
 
@@ -485,7 +573,7 @@ def setup_pthreads():
       diagnostics.warning('experimental', '-sMAIN_MODULE + pthreads is experimental')
     elif settings.LINKABLE:
       diagnostics.warning('experimental', '-sLINKABLE + pthreads is experimental')
-  if settings.ALLOW_MEMORY_GROWTH:
+  if settings.ALLOW_MEMORY_GROWTH and not settings.GROWABLE_ARRAYBUFFERS:
     diagnostics.warning('pthreads-mem-growth', '-pthread + ALLOW_MEMORY_GROWTH may run non-wasm code slowly, see https://github.com/WebAssembly/design/issues/1271')
 
   default_setting('DEFAULT_PTHREAD_STACK_SIZE', settings.STACK_SIZE)
@@ -1051,6 +1139,13 @@ def phase_linker_setup(options, state, newargs):
   if settings.ASYNCIFY_LAZY_LOAD_CODE:
     settings.ASYNCIFY = 1
 
+  if settings.ASYNCIFY_PROFILE:
+    if settings.ASYNCIFY != 1:
+      exit_with_error('ASYNCIFY_PROFILE requires ASYNCIFY=1')
+    # The profiler identifies the functions on the stack by the names that
+    # show up in stack traces.
+    settings.EMIT_NAME_SECTION = 1
+
   if settings.ASYNCIFY == 1:
     # See: https://github.com/emscripten-core/emscripten/issues/12065
     # See: https://github.com/emscripten-core/emscripten/issues/12066
@@ -1137,6 +1232,11 @@ def phase_linker_setup(options, state, newargs):
 
   setup_environment_settings()
 
+  if settings.SAMPLING_PROFILER:
+    if not settings.ENVIRONMENT_MAY_BE_NODE:
+      exit_with_error('SAMPLING_PROFILER is only supported under Node.js')
+    settings.DEFAULT_LIBRARY_FUNCS_TO_INCLUDE += ['$samplingProfiler']
+
   if settings.POLYFILL:
     # Emscripten requires certain ES6+ constructs by default in library code
     # - (various ES6 operators available in all browsers listed below)
@@ -1350,6 +1450,30 @@ def phase_linker_setup(options, state, newargs):
       settings.WASM_WORKER_FILE = unsuffixed(os.path.basename(target)) + '.ww.js'
     settings.JS_LIBRARIES.append((0, 'library_wasm_worker.js'))
 
+  if settings.MEMORY_SNAPSHOT:
+    diagnostics.warning('experimental', 'MEMORY_SNAPSHOT is experimental and subject to change')
+    if settings.PTHREADS or settings.WASM_WORKERS:
+      exit_with_error('MEMORY_SNAPSHOT is not compatible with pthreads or wasm workers')
+    if settings.RELOCATABLE:
+      exit_with_error('MEMORY_SNAPSHOT is not compatible with dynamic linking')
+    if settings.MINIMAL_RUNTIME:
+      exit_with_error('MEMORY_SNAPSHOT is not compatible with MINIMAL_RUNTIME')
+    if settings.SINGLE_FILE:
+      exit_with_error('MEMORY_SNAPSHOT is not compatible with SINGLE_FILE')
+    if settings.SPLIT_MODULE:
+      exit_with_error('MEMORY_SNAPSHOT is not compatible with SPLIT_MODULE')
+    if settings.EMBIND:
+      # embind registers its types from static constructors, and that state
+      # lives in JS.
+      exit_with_error('MEMORY_SNAPSHOT is not compatible with embind')
+    if not settings.ENVIRONMENT_MAY_BE_NODE:
+      exit_with_error('MEMORY_SNAPSHOT requires node in ENVIRONMENT, since the snapshot is taken under node')
+    settings.MEMORY_SNAPSHOT_FILE = unsuffixed(os.path.basename(target)) + '.snapshot'
+    # The environment is read again after restoring the snapshot.
+    settings.REQUIRED_EXPORTS += ['sbrk', '__emscripten_environ_constructor']
+    settings.JS_LIBRARIES.append((0, 'library_snapshot.js'))
+    settings.DEFAULT_LIBRARY_FUNCS_TO_INCLUDE += ['$loadSnapshot', '$initFromSnapshot', '$takeSnapshot']
+
   # Set min browser versions based on certain settings such as WASM_BIGINT,
   # PTHREADS, AUDIO_WORKLET
   # Such setting must be set before this point
@@ -1493,6 +1617,18 @@ def phase_linker_setup(options, state, newargs):
 
   if settings.WASM2JS:
     settings.MAYBE_WASM2JS = 1
+    if settings.GROWABLE_ARRAYBUFFERS:
+      exit_with_error('GROWABLE_ARRAYBUFFERS is not compatible with WASM2JS')
+
+  if settings.GROWABLE_ARRAYBUFFERS:
+    # The JS library only passes heap views to Web APIs after copying them
+    # out of shared memory, so views on the resizable buffer, which those APIs
+    # reject, are only safe with shared memory.  Without growth there is
+    # nothing to gain anyhow.
+    if not settings.SHARED_MEMORY or not settings.ALLOW_MEMORY_GROWTH:
+      exit_with_error('GROWABLE_ARRAYBUFFERS requires -pthread and -sALLOW_MEMORY_GROWTH')
+    if settings.USE_WEBGPU:
+      exit_with_error('GROWABLE_ARRAYBUFFERS is not compatible with USE_WEBGPU')
 
   if settings.AUTODEBUG:
     settings.REQUIRED_EXPORTS += ['_emscripten_tempret_set']
@@ -1503,6 +1639,22 @@ def phase_linker_setup(options, state, newargs):
   if settings.SPLIT_MODULE and settings.ASYNCIFY == 2:
     settings.DEFAULT_LIBRARY_FUNCS_TO_INCLUDE += ['_load_secondary_module']
 
+  if settings.SPLIT_MODULE_PROFILES:
+    if not settings.SPLIT_MODULE:
+      exit_with_error('SPLIT_MODULE_PROFILES requires SPLIT_MODULE')
+    if settings.ASYNCIFY == 2:
+      exit_with_error('SPLIT_MODULE_PROFILES is not compatible with JSPI')
+    if settings.RELOCATABLE:
+      exit_with_error('SPLIT_MODULE_PROFILES is not compatible with dynamic linking')
+    if settings.SINGLE_FILE:
+      exit_with_error('SPLIT_MODULE_PROFILES is not compatible with SINGLE_FILE')
+    if settings.MINIMAL_RUNTIME:
+      exit_with_error('SPLIT_MODULE_PROFILES is not compatible with MINIMAL_RUNTIME')
+    for profile in settings.SPLIT_MODULE_PROFILES:
+      if not os.path.isfile(profile):
+        exit_with_error(f'SPLIT_MODULE_PROFILES: profile not found: {profile}')
+    settings.SPLIT_MODULE_CHUNKS = 1
+
   # wasm side modules have suffix .wasm
   if settings.SIDE_MODULE and shared.suffix(target) == '.js':
     diagnostics.warning('emcc', 'output suffix .js requested, but wasm side modules are just wasm files; emitting only a .wasm, no .js')
@@ -1624,6 +1776,10 @@ def phase_linker_setup(options, state, newargs):
   if settings.USE_ASAN or settings.SAFE_HEAP:
     # ASan and SAFE_HEAP check address 0 themselves
     settings.CHECK_NULL_WRITES = 0
+  elif settings.WASM_SIMD:
+    # The SIMD string routines read whole aligned blocks, which ASan and
+    # SAFE_HEAP would report.
+    settings.SIMD_STRINGS = 1
 
   if sanitize and settings.GENERATE_SOURCE_MAP:
     settings.LOAD_SOURCE_MAP = 1
@@ -1956,6 +2112,7 @@ def run_embind_gen(wasm_target, js_syms, extra_settings, linker_inputs):
   # Disable proxying and thread pooling so a worker is not automatically created.
   settings.PROXY_TO_PTHREAD = False
   settings.PTHREAD_POOL_SIZE = 0
+  settings.PTHREAD_POOL_WARM = 0
   # Assume wasm support at binding generation time
   settings.WASM2JS = 0
   # Disable minify since the binaryen pass has not been run yet to change the
@@ -2128,6 +2285,11 @@ throw new Error('Dummy worker.js file should never be used');
 
   js_manipulation.handle_license(final_js)
 
+  if settings.SPLIT_MODULE_CHUNKS:
+    # Like do_split_module below, this works on the final wasm, which must be
+    # the same module that the profiles were taken from.
+    split_module_chunks(wasm_target, final_js, options)
+
   js_target = state.js_target
 
   # The JS is now final. Move it to its final location
@@ -2144,7 +2306,8 @@ throw new Error('Dummy worker.js file should never be used');
 
   if settings.SPLIT_MODULE:
     diagnostics.warning('experimental', 'the SPLIT_MODULE setting is experimental and subject to change')
-    do_split_module(wasm_target, options)
+    if not settings.SPLIT_MODULE_CHUNKS:
+      do_split_module(wasm_target, options)
 
   if not settings.SINGLE_FILE:
     tools.line_endings.convert_line_endings_in_file(js_target, os.linesep, options.output_eol)
@@ -2152,6 +2315,30 @@ throw new Error('Dummy worker.js file should never be used');
   if options.executable:
     make_js_executable(js_target)
 
+  if settings.MEMORY_SNAPSHOT:
+    take_memory_snapshot(js_target)
+
+
+def take_memory_snapshot(js_target):
+  # Run the program under node up to main(), and save its state.
+  snapshot_file = os.path.join(os.path.dirname(js_target), settings.MEMORY_SNAPSHOT_FILE)
+  delete_file(snapshot_file)
+  args = [js_target, snapshot_file]
+  if settings.EXPORT_ES6:
+    args.append('--es6')
+  if settings.MODULARIZE:
+    args.append('--modularize')
+  if settings.EXPORT_NAME != 'Module':
+    args.append('--export-name=' + settings.EXPORT_NAME)
+  node_args = []
+  if settings.MEMORY64:
+    node_args += shared.node_memory64_flags()
+  if settings.WASM_EXCEPTIONS:
+    node_args += shared.node_exception_flags(config.NODE_JS)
+  shared.run_js_tool(path_from_root('tools/take_snapshot.mjs'), args, node_args)
+  if not os.path.exists(snapshot_file):
+    exit_with_error('failed to take memory snapshot: the program exited before main()')
+
 
 @ToolchainProfiler.profile_block('binaryen')
 def phase_binaryen(target, options, wasm_target):
@@ -2218,7 +2405,7 @@ def phase_binaryen(target, options, wasm_target):
     # adds some >>> 0 things, while growth will replace a HEAP8 with a call to
     # a method to get the heap, and that call would not be recognized by the
     # unsigning pass
-    if settings.SHARED_MEMORY and settings.ALLOW_MEMORY_GROWTH:
+    if settings.SHARED_MEMORY and settings.ALLOW_MEMORY_GROWTH and not settings.GROWABLE_ARRAYBUFFERS:
       with ToolchainProfiler.profile_block('apply_wasm_memory_growth'):
         final_js = building.apply_wasm_memory_growth(final_js)
 
@@ -3012,6 +3199,10 @@ def package_files(options, target):
   if options.preload_files:
     # Preloading files uses --pre-js code that runs before the module is loaded.
     file_code = shared.check_call(cmd, stdout=PIPE).stdout
+    if settings.MEMORY_SNAPSHOT:
+      # The preloaded files are part of the snapshot, so they only need to be
+      # loaded while taking it.
+      file_code = "if (Module['takeSnapshot']) {\n" + file_code + "} else if (!Module['preRun']) Module['preRun'] = [];\n"
     js_manipulation.add_files_pre_js(settings.PRE_JS_FILES, file_code)
   else:
     # Otherwise, we are embedding files, which does not require --pre-js code,
@@ -5,7 +5,7 @@
 # found in the LICENSE file.
 
 """Updates the arm_neon.h header taken from SIMDe
-(https://github.com/simd-everywhere/simde) in system/include/neon
+(https://github.com/simd-everywhere/simde) in system/include/compat
 """
 
 import os
@@ -22,6 +22,8 @@ MEM_SIZE_SETTINGS = {
     'MEMORY_GROWTH_LINEAR_STEP',
     'MEMORY_GROWTH_GEOMETRIC_CAP',
     'GL_MAX_TEMP_BUFFER_SIZE',
+    'GL_CLIENT_ARRAY_RING_BUFFER_SIZE',
+    'MEMFS_PAGE_SIZE',
     'MAXIMUM_MEMORY',
     'DEFAULT_PTHREAD_STACK_SIZE'
 }
@@ -73,6 +75,8 @@ JS_ONLY_SETTINGS = {
     'PTHREAD_POOL_SIZE',
     'PTHREAD_POOL_SIZE_STRICT',
     'PTHREAD_POOL_DELAY_LOAD',
+    'PTHREAD_POOL_WARM',
+    'WASMFS_IO_THREADS',
     'DEFAULT_PTHREAD_STACK_SIZE',
 }
 
@@ -1283,6 +1283,7 @@ class libc(MuslInternalLibrary,
           'emscripten_console.c',
           'emscripten_fiber.c',
           'emscripten_get_heap_size.c',
+          'emscripten_heap_growth.c',
           'emscripten_memcpy.c',
           'emscripten_memmove.c',
           'emscripten_memset.c',
@@ -1399,6 +1400,34 @@ class libbulkmemory(MuslInternalLibrary, AsanInstrumentedLibrary):
     return super(libbulkmemory, self).can_use() and settings.BULK_MEMORY
 
 
+# wasm SIMD128 versions of the string scanning and comparison routines, plus the
+# helpers that the JS glue uses to convert long strings.  These read past the
+# end of strings (within aligned blocks) so they are not used with ASan or
+# SAFE_HEAP, which would report those reads.
+class libsimdstring(MuslInternalLibrary):
+  name = 'libsimdstring'
+  src_dir = 'system/lib/libc/simd'
+  src_files = ['memchr.c', 'memcmp.c', 'strchrnul.c', 'strcmp.c', 'strcspn.c',
+               'strlen.c', 'strspn.c', 'utf.c']
+  cflags = ['-O2', '-fno-builtin', '-msimd128']
+
+  def __init__(self, **kwargs):
+    # References to these can be generated during LTO codegen, so like their
+    # libc counterparts they are never compiled as bitcode.  See
+    # libc.get_libcall_files.
+    self.non_lto_files = files_in_path(path=self.src_dir,
+                                       filenames=['memcmp.c', 'strlen.c'])
+    super().__init__(**kwargs)
+
+  def customize_build_cmd(self, cmd, filename):
+    if filename in self.non_lto_files:
+      cmd = [a for a in cmd if not a.startswith('-flto')]
+    return cmd
+
+  def can_use(self):
+    return super(libsimdstring, self).can_use() and settings.SIMD_STRINGS
+
+
 class libprintf_long_double(libc):
   name = 'libprintf_long_double'
   cflags = ['-DEMSCRIPTEN_PRINTF_LONG_DOUBLE']
@@ -1660,6 +1689,14 @@ class libcxx(NoExceptLibrary, MTLibrary):
       cflags.append('-D__WASM_EXCEPTIONS__')
     return cflags
 
+  def get_files(self):
+    files = super().get_files()
+    if self.is_mt:
+      # In MT builds the PSTL uses the libdispatch backend, which we implement
+      # on top of pthreads (see __config_site).
+      files += files_in_path(path='system/lib/libcxx/src/pstl', filenames=['libdispatch.cpp'])
+    return files
+
 
 class libunwind(NoExceptLibrary, MTLibrary):
   name = 'libunwind'
@@ -1992,7 +2029,8 @@ class libwasmfs(DebugLibrary, AsanInstrumentedLibrary, MTLibrary):
                    'opfs_backend.cpp'])
     return backends + files_in_path(
         path='system/lib/wasmfs',
-        filenames=['file.cpp',
+        filenames=['async.cpp',
+                   'file.cpp',
                    'file_table.cpp',
                    'js_api.cpp',
                    'emscripten.cpp',
@@ -2036,7 +2074,7 @@ class libwasmfs_noderawfs(Library):
     return settings.WASMFS and settings.NODERAWFS
 
 
-class libhtml5(Library):
+class libhtml5(MTLibrary):
   name = 'libhtml5'
 
   includes = ['system/lib/libc']
@@ -2348,6 +2386,10 @@ def get_libs_to_link(args):
   # C libraries that override libc must come before it
   if settings.PRINTF_LONG_DOUBLE:
     add_library('libprintf_long_double')
+  # libsimdstring comes before libc_optz, so that its memcmp is used rather
+  # than the size optimized one.
+  if settings.SIMD_STRINGS:
+    add_library('libsimdstring')
   # See comment in libc_optz itself
   if settings.SHRINK_LEVEL >= 2 and not settings.LINKABLE and \
      not os.environ.get('EMCC_FORCE_STDLIBS'):
@@ -0,0 +1,64 @@
+#!/usr/bin/env node
+// Copyright 2024 The Emscripten Authors.  All rights reserved.
+// Emscripten is available under two separate licenses, the MIT license and the
+// University of Illinois/NCSA Open Source License.  Both these licenses can be
+// found in the LICENSE file.
+//
+// Runs a program built with -sMEMORY_SNAPSHOT up to the point where main()
+// would be called, and writes its state to the snapshot file that it loads on
+// startup.  See src/library_snapshot.js.
+//
+// Parameters:
+//    JS file        The generated JS of the program
+//    snapshot file  Where to write the snapshot
+//    --es6          The program is an ES6 module
+//    --modularize   The program was built with MODULARIZE
+//    --export-name=NAME
+//                   The EXPORT_NAME of the program, if not `Module`
+
+import * as fs from 'node:fs';
+import * as path from 'node:path';
+import * as vm from 'node:vm';
+import {createRequire} from 'node:module';
+import {pathToFileURL} from 'node:url';
+
+const args = process.argv.slice(2);
+const positional = args.filter((arg) => !arg.startsWith('--'));
+if (positional.length != 2) {
+  throw new Error('usage: take_snapshot.mjs <js file> <snapshot file> [--es6] [--modularize] [--export-name=NAME]');
+}
+const exportNameArg = args.find((arg) => arg.startsWith('--export-name='));
+const exportName = exportNameArg ? exportNameArg.split('=')[1] : 'Module';
+const jsFile = path.resolve(positional[0]);
+const snapshotFile = positional[1];
+
+const moduleArg = {
+  takeSnapshot(data) {
+    fs.writeFileSync(snapshotFile, data);
+  },
+};
+
+if (args.includes('--es6')) {
+  const {default: factory} = await import(pathToFileURL(jsFile));
+  factory(moduleArg);
+} else {
+  // Run the program as node would run it as a script, but with the incoming
+  // Module object already defined.
+  const module = {exports: {}};
+  const params = ['require', '__dirname', '__filename', 'module', 'exports', 'Module'];
+  const values = [createRequire(jsFile), path.dirname(jsFile), jsFile, module, module.exports, moduleArg];
+  if (exportName != 'Module') {
+    params.push(exportName);
+    values.push(moduleArg);
+  }
+  // Drop any `#!` line added by --executable.
+  const code = fs.readFileSync(jsFile, 'utf8').replace(/^#!.*/, '');
+  const wrapper = vm.runInThisContext(
+    `(function(${params.join(', ')}) {` + code + '\n})',
+    {filename: jsFile},
+  );
+  wrapper(...values);
+  if (args.includes('--modularize')) {
+    module.exports(moduleArg);
+  }
+}
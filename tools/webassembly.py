@@ -33,6 +33,9 @@ LIMITS_HAS_MAX = 0x1
 
 SEG_PASSIVE = 0x1
 
+ELEM_EXPLICIT_TABLE = 0x2
+ELEM_EXPRESSIONS = 0x4
+
 PREFIX_MATH = 0xfc
 PREFIX_THREADS = 0xfe
 PREFIX_SIMD = 0xfd
@@ -111,6 +114,7 @@ class OpCode(IntEnum):
   I32_ADD = 0x6a
   I64_ADD = 0x7c
   REF_NULL = 0xd0
+  REF_FUNC = 0xd2
   ATOMIC_PREFIX = 0xfe
   MEMORY_PREFIX = 0xfc
 
@@ -175,6 +179,7 @@ Dylink = namedtuple('Dylink', ['mem_size', 'mem_align', 'table_size', 'table_ali
 Table = namedtuple('Table', ['elem_type', 'limits'])
 FunctionBody = namedtuple('FunctionBody', ['offset', 'size'])
 DataSegment = namedtuple('DataSegment', ['flags', 'init', 'offset', 'size'])
+ElemSegment = namedtuple('ElemSegment', ['flags', 'table', 'init', 'count'])
 FuncType = namedtuple('FuncType', ['params', 'returns'])
 
 
@@ -236,7 +241,7 @@ class Module:
     while 1:
       opcode = OpCode(self.read_byte())
       args = []
-      if opcode == OpCode.GLOBAL_GET:
+      if opcode in (OpCode.GLOBAL_GET, OpCode.REF_FUNC):
         args.append(self.read_uleb())
       elif opcode in (OpCode.I32_CONST, OpCode.I64_CONST):
         args.append(self.read_sleb())
@@ -495,6 +500,34 @@ class Module:
       self.seek(offset + size)
     return segments
 
+  @memoize
+  def get_elem_segments(self):
+    elem_section = self.get_section(SecType.ELEM)
+    if not elem_section:
+      return []
+    self.seek(elem_section.offset)
+    segments = []
+    num_segments = self.read_uleb()
+    for _ in range(num_segments):
+      flags = self.read_uleb()
+      table = 0
+      init = None
+      if not flags & SEG_PASSIVE:
+        if flags & ELEM_EXPLICIT_TABLE:
+          table = self.read_uleb()
+        init = self.read_init()
+      if flags & (SEG_PASSIVE | ELEM_EXPLICIT_TABLE):
+        # elemkind or reftype
+        self.read_byte()
+      count = self.read_uleb()
+      for _ in range(count):
+        if flags & ELEM_EXPRESSIONS:
+          self.read_init()
+        else:
+          self.read_uleb()
+      segments.append(ElemSegment(flags, table, init, count))
+    return segments
+
   @memoize
   def get_tables(self):
     table_section = self.get_section(SecType.TABLE)
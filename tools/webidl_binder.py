@@ -97,7 +97,7 @@ pre_c = ['''
 #include <emscripten.h>
 #include <stdlib.h>
 
-EM_JS_DEPS(webidl_binder, "$intArrayFromString,$UTF8ToString,$alignMemory");
+EM_JS_DEPS(webidl_binder, "$intArrayFromString,$UTF8ToString,$stringToUTF8,$lengthBytesUTF8,$alignMemory,$stackSave,$stackRestore,$stackAlloc");
 ''']
 
 mid_c = ['''
@@ -187,70 +187,82 @@ function getClass(obj) {
 }
 Module['getClass'] = getClass;
 
-// Converts big (string or array) values into a C-style storage, in temporary space
+// Converts big (string or array) values into a C-style storage, in temporary
+// space that lives for the duration of a single call.  Small values go on the
+// wasm stack, larger ones into a reusable scratch buffer.  Calls that convert
+// values are bracketed by enter() and leave(), which also makes this safe when
+// C++ calls back into bound functions.
 
 /** @suppress {duplicate} (TODO: avoid emitting this multiple times, it is redundant) */
 var ensureCache = {
-  buffer: 0,  // the main buffer of temporary storage
-  size: 0,   // the size of buffer
-  pos: 0,    // the next free offset in buffer
-  temps: [], // extra allocations
-  needed: 0, // the total size we need next time
-
-  prepare() {
-    if (ensureCache.needed) {
-      // clear the temps
-      for (var i = 0; i < ensureCache.temps.length; i++) {
-        Module['_webidl_free'](ensureCache.temps[i]);
-      }
-      ensureCache.temps.length = 0;
-      // prepare to allocate a bigger buffer
-      Module['_webidl_free'](ensureCache.buffer);
-      ensureCache.buffer = 0;
-      ensureCache.size += ensureCache.needed;
-      // clean up
-      ensureCache.needed = 0;
+  buffer: 0,  // the scratch buffer
+  size: 0,    // the size of buffer
+  pos: 0,     // the next free offset in buffer
+  needed: 0,  // the size buffer should grow to when it is next empty
+  temps: [],  // allocations made when buffer was full, freed on leave()
+  frames: [], // saved state of the calls in progress
+  STACK_LIMIT: 512, // values up to this size are allocated on the stack
+
+  enter() {
+    ensureCache.frames.push(stackSave(), ensureCache.pos, ensureCache.temps.length);
+  },
+  leave() {
+    var temps = ensureCache.frames.pop();
+    while (ensureCache.temps.length > temps) {
+      Module['_webidl_free'](ensureCache.temps.pop());
+    }
+    ensureCache.pos = ensureCache.frames.pop();
+    stackRestore(ensureCache.frames.pop());
+  },
+  alloc(len) {
+    len = alignMemory(len, 8); // keep things aligned to 8 byte boundaries
+    if (len <= ensureCache.STACK_LIMIT) {
+      return stackAlloc(len);
     }
-    if (!ensureCache.buffer) { // happens first time, or when we need to grow
-      ensureCache.size += 128; // heuristic, avoid many small grow events
+    // The buffer can only be replaced while no call is using any of it.
+    if (!ensureCache.pos && ensureCache.size < Math.max(len, ensureCache.needed)) {
+      Module['_webidl_free'](ensureCache.buffer);
+      ensureCache.size = Math.max(len, ensureCache.needed, 2 * ensureCache.size);
       ensureCache.buffer = Module['_webidl_malloc'](ensureCache.size);
       assert(ensureCache.buffer);
     }
-    ensureCache.pos = 0;
-  },
-  alloc(array, view) {
-    assert(ensureCache.buffer);
-    var bytes = view.BYTES_PER_ELEMENT;
-    var len = array.length * bytes;
-    len = alignMemory(len, 8); // keep things aligned to 8 byte boundaries
-    var ret;
-    if (ensureCache.pos + len >= ensureCache.size) {
-      // we failed to allocate in the buffer, ensureCache time around :(
-      assert(len > 0); // null terminator, at least
-      ensureCache.needed += len;
-      ret = Module['_webidl_malloc'](len);
+    if (ensureCache.pos + len > ensureCache.size) {
+      ensureCache.needed = Math.max(ensureCache.needed, ensureCache.pos + len);
+      var ret = Module['_webidl_malloc'](len);
+      assert(ret);
       ensureCache.temps.push(ret);
-    } else {
-      // we can allocate in the buffer
-      ret = ensureCache.buffer + ensureCache.pos;
-      ensureCache.pos += len;
+      return ret;
     }
+    var ret = ensureCache.buffer + ensureCache.pos;
+    ensureCache.pos += len;
     return ret;
   },
-  copy(array, view, offset) {
-    offset /= view.BYTES_PER_ELEMENT;
-    for (var i = 0; i < array.length; i++) {
-      view[offset + i] = array[i];
+  // Returns the address of `array` in the heap, copying it into temporary
+  // space unless it is already a view of the heap with elements of the right
+  // type. Views of another type are converted element by element, like plain
+  // arrays, rather than reinterpreted.
+  copy(array, view) {
+    if (array.buffer === view.buffer && array.constructor === view.constructor) {
+      return array.byteOffset;
     }
+    var bytes = view.BYTES_PER_ELEMENT;
+    var offset = ensureCache.alloc(array.length * bytes);
+    // Allocating may have grown memory, replacing the heap views.
+    if (view.buffer !== HEAP8.buffer) view = new view.constructor(HEAP8.buffer);
+    view.set(array, offset / bytes);
+    return offset;
   },
 };
 
 /** @suppress {duplicate} (TODO: avoid emitting this multiple times, it is redundant) */
 function ensureString(value) {
   if (typeof value === 'string') {
-    var intArray = intArrayFromString(value);
-    var offset = ensureCache.alloc(intArray, HEAP8);
-    ensureCache.copy(intArray, HEAP8, offset);
+    // Short strings can skip measuring the UTF-8 length, since at most three
+    // bytes are needed per UTF-16 code unit.
+    var size = value.length * 3 + 1;
+    if (size > ensureCache.STACK_LIMIT) size = lengthBytesUTF8(value) + 1;
+    var offset = ensureCache.alloc(size);
+    stringToUTF8(value, offset, size);
     return offset;
   }
   return value;
@@ -259,9 +271,7 @@ function ensureString(value) {
 /** @suppress {duplicate} (TODO: avoid emitting this multiple times, it is redundant) */
 function ensureInt8(value) {
   if (typeof value === 'object') {
-    var offset = ensureCache.alloc(value, HEAP8);
-    ensureCache.copy(value, HEAP8, offset);
-    return offset;
+    return ensureCache.copy(value, HEAP8);
   }
   return value;
 }
@@ -269,9 +279,7 @@ function ensureInt8(value) {
 /** @suppress {duplicate} (TODO: avoid emitting this multiple times, it is redundant) */
 function ensureInt16(value) {
   if (typeof value === 'object') {
-    var offset = ensureCache.alloc(value, HEAP16);
-    ensureCache.copy(value, HEAP16, offset);
-    return offset;
+    return ensureCache.copy(value, HEAP16);
   }
   return value;
 }
@@ -279,9 +287,7 @@ function ensureInt16(value) {
 /** @suppress {duplicate} (TODO: avoid emitting this multiple times, it is redundant) */
 function ensureInt32(value) {
   if (typeof value === 'object') {
-    var offset = ensureCache.alloc(value, HEAP32);
-    ensureCache.copy(value, HEAP32, offset);
-    return offset;
+    return ensureCache.copy(value, HEAP32);
   }
   return value;
 }
@@ -289,9 +295,7 @@ function ensureInt32(value) {
 /** @suppress {duplicate} (TODO: avoid emitting this multiple times, it is redundant) */
 function ensureFloat32(value) {
   if (typeof value === 'object') {
-    var offset = ensureCache.alloc(value, HEAPF32);
-    ensureCache.copy(value, HEAPF32, offset);
-    return offset;
+    return ensureCache.copy(value, HEAPF32);
   }
   return value;
 }
@@ -299,9 +303,7 @@ function ensureFloat32(value) {
 /** @suppress {duplicate} (TODO: avoid emitting this multiple times, it is redundant) */
 function ensureFloat64(value) {
   if (typeof value === 'object') {
-    var offset = ensureCache.alloc(value, HEAPF64);
-    ensureCache.copy(value, HEAPF64, offset);
-    return offset;
+    return ensureCache.copy(value, HEAPF64);
   }
   return value;
 }
@@ -445,8 +447,10 @@ def render_function(class_name, func_name, sigs, return_type, non_pointer,
     body = ''
     pre_arg = []
 
-  if any(arg.type.isString() or arg.type.isArray() for arg in all_args):
-    body += '  ensureCache.prepare();\n'
+  uses_ensure_cache = any(arg.type.isString() or arg.type.isArray() for arg in all_args)
+  if uses_ensure_cache:
+    body += '  ensureCache.enter();\n'
+    body += '  try {\n'
 
   def is_ptr_arg(i):
     t = all_args[i].type
@@ -564,6 +568,10 @@ def render_function(class_name, func_name, sigs, return_type, non_pointer,
   body += '  %s_%s(%s)%s;\n' % (call_prefix, c_names[max_args], args_for_call, call_postfix)
   if cache:
     body += f'  {cache}\n'
+  if uses_ensure_cache:
+    body += '  } finally {\n'
+    body += '    ensureCache.leave();\n'
+    body += '  }\n'
 
   if constructor:
     declare_name = ' ' + func_name